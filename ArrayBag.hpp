@@ -0,0 +1,160 @@
+/**
+ * @file ArrayBag.hpp
+ * @brief This file contains the declaration and implementation of the ArrayBag class template.
+ *
+ * ArrayBag stores up to DEFAULT_CAPACITY items in a fixed-size array that is part of the bag itself, so a bag never
+ * allocates and `add` fails once it is full. Removing an item fills its slot with the last item. It is the storage a
+ * Kitchen uses when KITCHEN_FIXED_CAPACITY is defined; ResizableArrayBag has the same interface and grows instead.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef ARRAY_BAG_HPP
+#define ARRAY_BAG_HPP
+
+#include <vector>
+
+template<class ItemType>
+class ArrayBag {
+public:
+    /**
+     * Default constructor.
+     * Creates an empty bag.
+     */
+    ArrayBag();
+
+    /**
+     * @return The number of items currently in the bag.
+     */
+    int getCurrentSize() const;
+
+    /**
+     * @return True if the bag is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @param new_entry A reference to the item to be added.
+     * @post If the bag is not full, stores the item at the end of the bag.
+     * @return True if the item was added, false if the bag already holds DEFAULT_CAPACITY items.
+     */
+    bool add(const ItemType& new_entry);
+
+    /**
+     * @param an_entry A reference to the item to be removed.
+     * @post If found, the item is removed and its slot is filled with the last item in the bag.
+     * @return True if the item was found and removed, false otherwise.
+     */
+    bool remove(const ItemType& an_entry);
+
+    /**
+     * @post The bag is empty.
+     */
+    void clear();
+
+    /**
+     * @param an_entry A reference to the item to be found.
+     * @return True if the bag contains an item equal to `an_entry`, false otherwise.
+     */
+    bool contains(const ItemType& an_entry) const;
+
+    /**
+     * @param an_entry A reference to the item to be counted.
+     * @return The number of items in the bag equal to `an_entry`.
+     */
+    int getFrequencyOf(const ItemType& an_entry) const;
+
+    /**
+     * @return A vector holding copies of the items in the bag, in bag order.
+     */
+    std::vector<ItemType> toVector() const;
+
+protected:
+    static const int DEFAULT_CAPACITY = 100; // the most items the bag can hold
+    ItemType items_[DEFAULT_CAPACITY];       // array of bag items
+    int item_count_;                         // current count of bag items
+
+    /**
+     * @param target A reference to the item to be found.
+     * @return Either the index of the target in items_ or -1 if the bag does not contain it.
+     */
+    int getIndexOf(const ItemType& target) const;
+};
+
+template<class ItemType>
+ArrayBag<ItemType>::ArrayBag() : item_count_(0) {
+}
+
+template<class ItemType>
+int ArrayBag<ItemType>::getCurrentSize() const {
+    return item_count_;
+}
+
+template<class ItemType>
+bool ArrayBag<ItemType>::isEmpty() const {
+    return item_count_ == 0;
+}
+
+template<class ItemType>
+bool ArrayBag<ItemType>::add(const ItemType& new_entry) {
+    if (item_count_ >= DEFAULT_CAPACITY) {
+        return false;
+    }
+
+    items_[item_count_] = new_entry;
+    item_count_++;
+    return true;
+}
+
+template<class ItemType>
+bool ArrayBag<ItemType>::remove(const ItemType& an_entry) {
+    int found_index = getIndexOf(an_entry);
+    if (found_index < 0) {
+        return false;
+    }
+
+    item_count_--;
+    if (found_index != item_count_) {
+        items_[found_index] = items_[item_count_];
+    }
+    return true;
+}
+
+template<class ItemType>
+void ArrayBag<ItemType>::clear() {
+    item_count_ = 0;
+}
+
+template<class ItemType>
+bool ArrayBag<ItemType>::contains(const ItemType& an_entry) const {
+    return getIndexOf(an_entry) > -1;
+}
+
+template<class ItemType>
+int ArrayBag<ItemType>::getFrequencyOf(const ItemType& an_entry) const {
+    int frequency = 0;
+    for (int i = 0; i < item_count_; ++i) {
+        if (items_[i] == an_entry) {
+            frequency++;
+        }
+    }
+    return frequency;
+}
+
+template<class ItemType>
+std::vector<ItemType> ArrayBag<ItemType>::toVector() const {
+    return std::vector<ItemType>(items_, items_ + item_count_);
+}
+
+template<class ItemType>
+int ArrayBag<ItemType>::getIndexOf(const ItemType& target) const {
+    for (int i = 0; i < item_count_; ++i) {
+        if (items_[i] == target) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#endif // ARRAY_BAG_HPP
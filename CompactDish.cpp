@@ -0,0 +1,85 @@
+/**
+ * @file CompactDish.cpp
+ * @brief This file contains the implementation of the CompactDish class, a 16-byte, scan-friendly representation of
+ * a Dish.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "CompactDish.hpp"
+#include "IngredientListPool.hpp"
+#include <limits>
+#include <vector>
+
+namespace {
+
+bool fitsHotFields(const Dish& a_dish) {
+    Price::Cents cents = a_dish.getPriceValue().cents();
+    return a_dish.getPrepTime() >= 0 && a_dish.getPrepTime() <= CompactDish::MAX_PREP_TIME
+        && cents >= std::numeric_limits<std::int32_t>::min() && cents <= std::numeric_limits<std::int32_t>::max();
+}
+
+} // namespace
+
+CompactDish::CompactDish() : CompactDish(Dish(), false) {
+}
+
+CompactDish::CompactDish(const Dish& a_dish, bool elaborate)
+    : price_cents_(0), prep_time_(0), cuisine_type_(static_cast<std::uint8_t>(a_dish.getCuisineTypeEnum())),
+      flags_(elaborate ? ELABORATE_FLAG : 0) {
+    std::vector<StringPool::Id> record;
+    record.reserve(FIRST_INGREDIENT + a_dish.getIngredientCount() + WIDE_FIELD_COUNT);
+    record.push_back(a_dish.getNameId());
+    record.push_back(static_cast<StringPool::Id>(a_dish.getIngredientCount()));
+    for (int i = 0; i < a_dish.getIngredientCount(); ++i) {
+        record.push_back(a_dish.getIngredientId(i));
+    }
+    Price::Cents cents = a_dish.getPriceValue().cents();
+    if (fitsHotFields(a_dish)) {
+        price_cents_ = static_cast<std::int32_t>(cents);
+        prep_time_ = static_cast<std::uint16_t>(a_dish.getPrepTime());
+    } else {
+        // The hot fields are left at 0; every reader goes through the cold record
+        flags_ |= WIDE_FLAG;
+        std::uint64_t bits = static_cast<std::uint64_t>(cents);
+        record.push_back(static_cast<StringPool::Id>(static_cast<std::uint32_t>(a_dish.getPrepTime())));
+        record.push_back(static_cast<StringPool::Id>(bits & 0xFFFFFFFFu));
+        record.push_back(static_cast<StringPool::Id>(bits >> 32));
+    }
+    cold_ = IngredientListPool::global().intern(record.data(), record.size());
+}
+
+Dish CompactDish::toDish() const {
+    std::vector<std::string> ingredients;
+    ingredients.reserve(getIngredientCount());
+    for (int i = 0; i < getIngredientCount(); ++i) {
+        ingredients.push_back(getIngredient(i));
+    }
+    Dish a_dish(getName(), std::move(ingredients), getPrepTime(), 0.0, getCuisineTypeEnum());
+    a_dish.setPrice(Price::fromCents(getPriceCents()));
+    return a_dish;
+}
+
+const std::string& CompactDish::getName() const {
+    return StringPool::global().lookup(getNameId());
+}
+
+const std::string& CompactDish::getIngredient(int index) const {
+    return StringPool::global().lookup(getIngredientId(index));
+}
+
+bool CompactDish::operator==(const CompactDish& rhs) const {
+    return getNameId() == rhs.getNameId() && cuisine_type_ == rhs.cuisine_type_ && getPrepTime() == rhs.getPrepTime() &&
+           getPriceCents() == rhs.getPriceCents();
+}
+
+int CompactDish::widePrepTime() const {
+    return static_cast<int>(cold_[FIRST_INGREDIENT + getIngredientCount() + WIDE_PREP_TIME]);
+}
+
+Price::Cents CompactDish::widePriceCents() const {
+    const StringPool::Id* wide = cold_ + FIRST_INGREDIENT + getIngredientCount();
+    std::uint64_t bits = (static_cast<std::uint64_t>(wide[WIDE_PRICE_HIGH]) << 32) | wide[WIDE_PRICE_LOW];
+    return static_cast<Price::Cents>(bits);
+}
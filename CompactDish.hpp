@@ -0,0 +1,113 @@
+/**
+ * @file CompactDish.hpp
+ * @brief This file contains the declaration of the CompactDish class, a 16-byte, scan-friendly representation of a
+ * Dish.
+ *
+ * The fields that scans and aggregates read (price, preparation time, cuisine type and the elaborate flag) are packed
+ * into the first 8 bytes: the price as integer cents, the preparation time as a 16-bit count of minutes and the
+ * cuisine type as a single byte. The cold data (the name and the ingredient list) sits behind one pointer to a
+ * record interned in IngredientListPool::global(), so four CompactDish fit in a cache line where a Dish takes more
+ * than half of one. A CompactDish is trivially copyable and owns no memory.
+ *
+ * A preparation time outside [0, MAX_PREP_TIME] or a price outside a 32-bit count of cents does not fit the hot
+ * fields. Such a dish is flagged wide and keeps its exact values at the end of its cold record, so the getters,
+ * `operator==` and `toDish` always agree with the Dish it was packed from; only wide dishes pay the indirection.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef COMPACT_DISH_HPP
+#define COMPACT_DISH_HPP
+
+#include "Dish.hpp"
+#include "Price.hpp"
+#include "StringPool.hpp"
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+class CompactDish {
+public:
+    // Largest preparation time stored in the hot fields; longer times are kept in the cold record
+    static const int MAX_PREP_TIME = 0xFFFF;
+
+    /**
+     * Default constructor.
+     * Creates the compact form of `Dish()`.
+     */
+    CompactDish();
+
+    /**
+     * @param a_dish A reference to the dish to be packed.
+     * @param elaborate Whether the dish counts as elaborate, e.g. under the owning kitchen's rule.
+     * @post Holds the fields of the dish exactly. A preparation time or price that does not fit the hot fields is
+     * kept in the cold record, see `isWide`.
+     */
+    CompactDish(const Dish& a_dish, bool elaborate);
+
+    /**
+     * @return A Dish with the same name, ingredients, preparation time, price and cuisine type.
+     */
+    Dish toDish() const;
+
+    // Hot fields, read from the cold record instead for wide dishes
+    int getPrepTime() const { return isWide() ? widePrepTime() : prep_time_; }
+    Price::Cents getPriceCents() const { return isWide() ? widePriceCents() : price_cents_; }
+    double getPrice() const { return getPriceCents() / 100.0; }
+    Dish::CuisineType getCuisineTypeEnum() const { return static_cast<Dish::CuisineType>(cuisine_type_); }
+    bool isElaborate() const { return (flags_ & ELABORATE_FLAG) != 0; }
+
+    /**
+     * @return True if the preparation time or the price did not fit the hot fields and is kept in the cold record.
+     */
+    bool isWide() const { return (flags_ & WIDE_FLAG) != 0; }
+
+    // Cold fields, one indirection away
+    StringPool::Id getNameId() const { return cold_[NAME_ID]; }
+    const std::string& getName() const;
+    int getIngredientCount() const { return static_cast<int>(cold_[INGREDIENT_COUNT]); }
+    StringPool::Id getIngredientId(int index) const { return cold_[FIRST_INGREDIENT + index]; }
+    const std::string& getIngredient(int index) const;
+
+    /**
+     * @param rhs A reference to another CompactDish.
+     * @return True if the name, cuisine type, preparation time and price are equal, like Dish::operator==.
+     */
+    bool operator==(const CompactDish& rhs) const;
+
+    /**
+     * @param rhs A reference to another CompactDish.
+     * @return True if the dishes are not equal.
+     */
+    bool operator!=(const CompactDish& rhs) const { return !(*this == rhs); }
+
+private:
+    // Layout of the interned cold record: name Id, ingredient count, the ingredient Ids, then for wide dishes the
+    // preparation time and the low and high halves of the price in cents
+    enum ColdField { NAME_ID = 0, INGREDIENT_COUNT = 1, FIRST_INGREDIENT = 2 };
+    enum WideField { WIDE_PREP_TIME = 0, WIDE_PRICE_LOW = 1, WIDE_PRICE_HIGH = 2, WIDE_FIELD_COUNT = 3 };
+    static const std::uint8_t ELABORATE_FLAG = 1;
+    static const std::uint8_t WIDE_FLAG = 2;
+
+    std::int32_t price_cents_;
+    std::uint16_t prep_time_;
+    std::uint8_t cuisine_type_;
+    std::uint8_t flags_;
+    const StringPool::Id* cold_;  // record pooled in IngredientListPool::global()
+
+    /**
+     * @return The exact preparation time of a wide dish.
+     */
+    int widePrepTime() const;
+
+    /**
+     * @return The exact price in cents of a wide dish.
+     */
+    Price::Cents widePriceCents() const;
+};
+
+static_assert(sizeof(CompactDish) == 16, "CompactDish must stay 16 bytes, four per cache line");
+static_assert(std::is_trivially_copyable<CompactDish>::value, "CompactDish must be copyable with memcpy");
+
+#endif // COMPACT_DISH_HPP
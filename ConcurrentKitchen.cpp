@@ -0,0 +1,237 @@
+/**
+ * @file ConcurrentKitchen.cpp
+ * @brief This file contains the implementation of the ConcurrentKitchen class, a thread-safe Kitchen for several order stations.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "ConcurrentKitchen.hpp"
+#include "DishIndex.hpp"
+#include <thread>
+
+int ConcurrentKitchen::Snapshot::calculateAvgPrepTime() const {
+    return KitchenStats::averagePrepTime(total_prep_time, dish_count);
+}
+
+double ConcurrentKitchen::Snapshot::calculateElaboratePercentage() const {
+    return KitchenStats::elaboratePercentage(elaborate_count, dish_count);
+}
+
+ConcurrentKitchen::ConcurrentKitchen()
+    : ConcurrentKitchen(static_cast<int>(std::thread::hardware_concurrency())) {
+}
+
+ConcurrentKitchen::ConcurrentKitchen(int shard_count) {
+    if (shard_count < 1) {
+        shard_count = 1;
+    }
+    shards_.reserve(shard_count);
+    for (int i = 0; i < shard_count; ++i) {
+        shards_.push_back(std::unique_ptr<Shard>(new Shard()));
+    }
+}
+
+int ConcurrentKitchen::getShardCount() const {
+    return static_cast<int>(shards_.size());
+}
+
+bool ConcurrentKitchen::newOrder(const Dish& a_dish) {
+    Shard& shard = shardFor(a_dish);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.kitchen.newOrder(a_dish)) {
+        return false;
+    }
+    publish(shard);
+    return true;
+}
+
+bool ConcurrentKitchen::newOrder(Dish&& a_dish) {
+    Shard& shard = shardFor(a_dish);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.kitchen.newOrder(std::move(a_dish))) {
+        return false;
+    }
+    publish(shard);
+    return true;
+}
+
+bool ConcurrentKitchen::serveDish(const Dish& a_dish) {
+    Shard& shard = shardFor(a_dish);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.kitchen.serveDish(a_dish)) {
+        return false;
+    }
+    publish(shard);
+    return true;
+}
+
+bool ConcurrentKitchen::contains(const Dish& a_dish) const {
+    Shard& shard = shardFor(a_dish);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.kitchen.contains(a_dish);
+}
+
+int ConcurrentKitchen::releaseDishesBelowPrepTime(int prepTimeThreshold) {
+    int removed_count = 0;
+    for (const std::unique_ptr<Shard>& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        int removed = shard->kitchen.releaseDishesBelowPrepTime(prepTimeThreshold);
+        if (removed > 0) {
+            publish(*shard);
+            removed_count += removed;
+        }
+    }
+    return removed_count;
+}
+
+int ConcurrentKitchen::releaseDishesOfCuisineType(const std::string& cuisineType) {
+    int removed_count = 0;
+    for (const std::unique_ptr<Shard>& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        int removed = shard->kitchen.releaseDishesOfCuisineType(cuisineType);
+        if (removed > 0) {
+            publish(*shard);
+            removed_count += removed;
+        }
+    }
+    return removed_count;
+}
+
+void ConcurrentKitchen::setElaboratePolicy(const ElaboratePolicy& policy) {
+    for (const std::unique_ptr<Shard>& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->kitchen.setElaboratePolicy(policy);
+        publish(*shard);
+    }
+}
+
+ConcurrentKitchen::Snapshot ConcurrentKitchen::snapshot() const {
+    Snapshot total;
+    for (const std::unique_ptr<Shard>& shard : shards_) {
+        readPublished(*shard, total);
+    }
+    return total;
+}
+
+KitchenStats ConcurrentKitchen::stats() const {
+    KitchenStats total;
+    for (const std::unique_ptr<Shard>& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        total.merge(shard->kitchen.stats());
+    }
+    return total;
+}
+
+std::shared_ptr<const KitchenView> ConcurrentKitchen::view() const {
+    // Locks are always taken in shard order, so this cannot deadlock with another view()
+    std::vector<std::unique_lock<std::mutex>> locks;
+    locks.reserve(shards_.size());
+    for (const std::unique_ptr<Shard>& shard : shards_) {
+        locks.emplace_back(shard->mutex);
+    }
+    std::vector<std::shared_ptr<const KitchenView>> shard_views;
+    shard_views.reserve(shards_.size());
+    for (const std::unique_ptr<Shard>& shard : shards_) {
+        shard_views.push_back(shard->kitchen.view());
+    }
+    locks.clear();
+    return std::make_shared<const KitchenView>(KitchenView::concatenate(shard_views));
+}
+
+int ConcurrentKitchen::getCurrentSize() const {
+    return snapshot().dish_count;
+}
+
+int ConcurrentKitchen::getPrepTimeSum() const {
+    return static_cast<int>(snapshot().total_prep_time);
+}
+
+Price ConcurrentKitchen::totalRevenue() const {
+    return Price::fromCents(snapshot().total_revenue_cents);
+}
+
+int ConcurrentKitchen::calculateAvgPrepTime() const {
+    return snapshot().calculateAvgPrepTime();
+}
+
+int ConcurrentKitchen::elaborateDishCount() const {
+    return snapshot().elaborate_count;
+}
+
+double ConcurrentKitchen::calculateElaboratePercentage() const {
+    return snapshot().calculateElaboratePercentage();
+}
+
+int ConcurrentKitchen::tallyCuisineTypes(Dish::CuisineType cuisineType) const {
+    if (Dish::validCuisineType(cuisineType) != cuisineType) {
+        return 0;
+    }
+    return snapshot().cuisine_counts[cuisineType];
+}
+
+int ConcurrentKitchen::tallyCuisineTypes(const std::string& cuisineType) const {
+    Dish::CuisineType cuisine_type;
+    if (!Dish::stringToCuisineType(cuisineType, cuisine_type)) {
+        return 0;
+    }
+    return tallyCuisineTypes(cuisine_type);
+}
+
+void ConcurrentKitchen::kitchenReport(std::ostream& out) const {
+    Snapshot total = snapshot();
+    std::array<long long, Dish::CUISINE_TYPE_COUNT> cuisine_counts;
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+        cuisine_counts[c] = total.cuisine_counts[c];
+    }
+    std::string buffer;
+    KitchenStats::appendReport(buffer, cuisine_counts, total.total_prep_time, total.elaborate_count, total.dish_count);
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+ConcurrentKitchen::Shard& ConcurrentKitchen::shardFor(const Dish& a_dish) const {
+    return *shards_[DishHash()(a_dish) % shards_.size()];
+}
+
+void ConcurrentKitchen::publish(Shard& shard) {
+    unsigned sequence = shard.sequence.load(std::memory_order_relaxed);
+    shard.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    shard.dish_count.store(shard.kitchen.getCurrentSize(), std::memory_order_relaxed);
+    shard.total_prep_time.store(shard.kitchen.getPrepTimeSum(), std::memory_order_relaxed);
+    shard.total_revenue_cents.store(shard.kitchen.totalRevenue().cents(), std::memory_order_relaxed);
+    shard.elaborate_count.store(shard.kitchen.elaborateDishCount(), std::memory_order_relaxed);
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+        shard.cuisine_counts[c].store(shard.kitchen.tallyCuisineTypes(static_cast<Dish::CuisineType>(c)),
+                                      std::memory_order_relaxed);
+    }
+
+    shard.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+void ConcurrentKitchen::readPublished(const Shard& shard, Snapshot& total) {
+    Snapshot part;
+    unsigned before;
+    unsigned after;
+    do {
+        before = shard.sequence.load(std::memory_order_acquire);
+        part.dish_count = shard.dish_count.load(std::memory_order_relaxed);
+        part.total_prep_time = shard.total_prep_time.load(std::memory_order_relaxed);
+        part.total_revenue_cents = shard.total_revenue_cents.load(std::memory_order_relaxed);
+        part.elaborate_count = shard.elaborate_count.load(std::memory_order_relaxed);
+        for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+            part.cuisine_counts[c] = shard.cuisine_counts[c].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = shard.sequence.load(std::memory_order_relaxed);
+    } while ((before & 1u) != 0 || before != after);
+
+    total.dish_count += part.dish_count;
+    total.total_prep_time += part.total_prep_time;
+    total.total_revenue_cents += part.total_revenue_cents;
+    total.elaborate_count += part.elaborate_count;
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+        total.cuisine_counts[c] += part.cuisine_counts[c];
+    }
+}
@@ -0,0 +1,192 @@
+/**
+ * @file ConcurrentKitchen.hpp
+ * @brief This file contains the declaration of the ConcurrentKitchen class, a thread-safe Kitchen for several order stations.
+ *
+ * ConcurrentKitchen splits its dishes over a number of shards, each a Kitchen guarded by its own mutex. A dish always
+ * goes to the shard chosen by its DishHash, so equal dishes meet in the same shard and duplicate detection stays
+ * exact, while orders for different dishes proceed in parallel. After every change a shard publishes its running
+ * totals through a sequence lock, so aggregate queries read consistent per-shard totals without taking any lock and
+ * without blocking writers. The shards are read one after another, so these totals are not a point in time of the
+ * whole kitchen: a change to several shards, e.g. a release, may be seen in some shards and not yet in others.
+ * `view()` locks every shard at once, so its dishes and its `KitchenView::stats()` are of one point in time.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef CONCURRENT_KITCHEN_HPP
+#define CONCURRENT_KITCHEN_HPP
+
+#include "Kitchen.hpp"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class ConcurrentKitchen {
+public:
+    /**
+     * Running totals of a ConcurrentKitchen, read as one consistent value per shard. Different shards may be read at
+     * different times, so the sum is not always a state the whole kitchen was in; use `view()` for that.
+     */
+    struct Snapshot {
+        int dish_count = 0;
+        long long total_prep_time = 0;
+        Price::Cents total_revenue_cents = 0;
+        int elaborate_count = 0;
+        std::array<int, Dish::CUISINE_TYPE_COUNT> cuisine_counts{};
+
+        /**
+         * @return : The average preparation time rounded to the nearest integer, 0 if there are no dishes.
+         */
+        int calculateAvgPrepTime() const;
+
+        /**
+         * @return : The percentage of elaborate dishes rounded up to 2 decimal places, 0 if there are none.
+         */
+        double calculateElaboratePercentage() const;
+    };
+
+    /**
+     * Default constructor.
+     * Creates one shard per hardware thread (at least one).
+     */
+    ConcurrentKitchen();
+
+    /**
+     * Parameterized constructor.
+     * @param : The number of shards, at least 1. More shards let more writers proceed in parallel.
+     */
+    explicit ConcurrentKitchen(int shard_count);
+
+    ConcurrentKitchen(const ConcurrentKitchen&) = delete;
+    ConcurrentKitchen& operator=(const ConcurrentKitchen&) = delete;
+
+    /**
+     * @return : The number of shards.
+     */
+    int getShardCount() const;
+
+    /**
+     * @param : A reference to a `Dish` being added to the kitchen.
+     * @post : Same as `Kitchen::newOrder`, locking only the dish's shard.
+     * @return : Returns true if the `Dish` was added, false if an equal dish is already in the kitchen.
+     */
+    bool newOrder(const Dish& a_dish);
+
+    /**
+     * @param : A `Dish` being added to the kitchen, moved into the kitchen if it is added.
+     * @return : Returns true if the `Dish` was added, false if an equal dish is already in the kitchen.
+     */
+    bool newOrder(Dish&& a_dish);
+
+    /**
+     * @param : A reference to a `Dish` leaving the kitchen.
+     * @post : Same as `Kitchen::serveDish`, locking only the dish's shard.
+     * @return : Returns true if a dish was removed, false otherwise.
+     */
+    bool serveDish(const Dish& a_dish);
+
+    /**
+     * @param : A reference to a `Dish`.
+     * @return : Returns true if a dish equal to the given `Dish` is in the kitchen, false otherwise.
+     */
+    bool contains(const Dish& a_dish) const;
+
+    /**
+     * @param : A reference to an integer representing the preparation time threshold.
+     * @post : Removes all dishes whose preparation time is less than the given time, one shard at a time.
+     * @return : The number of dishes removed.
+     */
+    int releaseDishesBelowPrepTime(int prepTimeThreshold);
+
+    /**
+     * @param : A reference to a string representing a cuisine type, see `Kitchen::releaseDishesOfCuisineType`.
+     * @post : Removes all dishes of the given cuisine type, one shard at a time.
+     * @return : The number of dishes removed.
+     */
+    int releaseDishesOfCuisineType(const std::string& cuisineType);
+
+    /**
+     * @param : A reference to the rule deciding whether a dish is elaborate.
+     * @post : Same as `Kitchen::setElaboratePolicy` on every shard, one shard at a time.
+     */
+    void setElaboratePolicy(const ElaboratePolicy& policy);
+
+    /**
+     * @return : The running totals of all shards. Never blocks writers. Each shard's totals are
+     * consistent, but the shards are read one after another, so a change spanning several shards,
+     * e.g. `releaseDishesBelowPrepTime`, may be only partly included. Callers that need the totals
+     * of the whole kitchen at one point in time should read `view()->stats()` instead.
+     */
+    Snapshot snapshot() const;
+
+    /**
+     * @return : The statistics of all shards merged, including their preparation time sketches.
+     * Takes each shard's lock in turn, so like `snapshot()` the shards may be read at different times.
+     */
+    KitchenStats stats() const;
+
+    /**
+     * @return : An immutable view of all shards at one point in time, see `Kitchen::view`. Holds
+     * every shard's lock only while the shards' changed chunks are copied; the view can then be
+     * read for as long as needed without holding up any writer. The shard locks also serialize
+     * `Kitchen::view` with the shard's writers, as it updates the shard's latest view.
+     */
+    std::shared_ptr<const KitchenView> view() const;
+
+    // Aggregate queries, each answered from one snapshot() without locking, so consistent per shard only
+    int getCurrentSize() const;
+    int getPrepTimeSum() const;
+    Price totalRevenue() const;
+    int calculateAvgPrepTime() const;
+    int elaborateDishCount() const;
+    double calculateElaboratePercentage() const;
+    int tallyCuisineTypes(Dish::CuisineType cuisineType) const;
+    int tallyCuisineTypes(const std::string& cuisineType) const;
+
+    /**
+     * @param : A reference to the output stream the report is written to.
+     * @post : Writes the report described in `Kitchen::kitchenReport()` for one `snapshot()`, consistent
+     * per shard; `view()->kitchenReport(out)` reports the whole kitchen at one point in time.
+     */
+    void kitchenReport(std::ostream& out) const;
+
+private:
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;  // guards kitchen
+        Kitchen kitchen;
+        // Totals of kitchen, published under a sequence lock: odd while being written
+        std::atomic<unsigned> sequence{0};
+        std::atomic<int> dish_count{0};
+        std::atomic<long long> total_prep_time{0};
+        std::atomic<Price::Cents> total_revenue_cents{0};
+        std::atomic<int> elaborate_count{0};
+        std::array<std::atomic<int>, Dish::CUISINE_TYPE_COUNT> cuisine_counts{};
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+
+    /**
+     * @param : A reference to a `Dish`.
+     * @return : A reference to the shard the dish belongs to.
+     */
+    Shard& shardFor(const Dish& a_dish) const;
+
+    /**
+     * @param : A reference to a shard whose mutex is held by the caller.
+     * @post : Copies the shard kitchen's totals into its published totals.
+     */
+    static void publish(Shard& shard);
+
+    /**
+     * @param : A reference to a shard.
+     * @param : A reference to the snapshot the shard's published totals are added to.
+     */
+    static void readPublished(const Shard& shard, Snapshot& total);
+};
+
+#endif // CONCURRENT_KITCHEN_HPP
@@ -10,93 +10,288 @@
  */
 
 #include "Dish.hpp"
+#include "TextFormat.hpp"
 #include <iostream>
-#include <iomanip> // For std::fixed and std::setprecision
+#include <utility>
 #include <cctype>  // For std::isalpha, std::isspace
 
+#ifdef DISH_NO_STRING_POOL
+
 // Default Constructor
 Dish::Dish() 
-    : name_("UNKNOWN"), ingredients_({}), prep_time_(0), price_(0.0), cuisine_type_(CuisineType::OTHER) {
+    : name_("UNKNOWN"), ingredients_({}), prep_time_(0), price_(), cuisine_type_(CuisineType::OTHER), elaborate_(false) {
 }
 
 // Parameterized Constructor
-Dish::Dish(const std::string& name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type)
-    : ingredients_(ingredients), prep_time_(prep_time), price_(price), cuisine_type_(cuisine_type) {
-    setName(name);  // Use setName to validate the name
+Dish::Dish(std::string name, std::vector<std::string> ingredients, int prep_time, double price, CuisineType cuisine_type)
+    : ingredients_(std::move(ingredients)), prep_time_(prep_time), price_(Price::fromDouble(price)), cuisine_type_(validCuisineType(cuisine_type)), elaborate_(false) {
+    setName(std::move(name));  // Use setName to validate the name
+    updateElaborate();
 }
 
 // Accessor Functions
-std::string Dish::getName() const {
+const std::string& Dish::getName() const {
     return name_;
 }
 
+StringPool::Id Dish::getNameId() const {
+    return StringPool::global().intern(name_);
+}
+
 std::vector<std::string> Dish::getIngredients() const {
     return ingredients_;
 }
 
+int Dish::getIngredientCount() const {
+    return static_cast<int>(ingredients_.size());
+}
+
+const std::string& Dish::getIngredient(int index) const {
+    return ingredients_[index];
+}
+
+StringPool::Id Dish::getIngredientId(int index) const {
+    return StringPool::global().intern(ingredients_[index]);
+}
+
+#else
+
+// Default Constructor
+Dish::Dish() 
+    : name_id_(unknownNameId()), ingredient_count_(0), ingredient_ids_(nullptr), prep_time_(0), price_(), cuisine_type_(CuisineType::OTHER), elaborate_(false) {
+}
+
+// Parameterized Constructor
+Dish::Dish(std::string name, std::vector<std::string> ingredients, int prep_time, double price, CuisineType cuisine_type)
+    : ingredient_count_(0), ingredient_ids_(nullptr), prep_time_(prep_time), price_(Price::fromDouble(price)), cuisine_type_(validCuisineType(cuisine_type)), elaborate_(false) {
+    setName(std::move(name));  // Use setName to validate the name
+    setIngredients(std::move(ingredients));  // also classifies the dish
+}
+
+// Accessor Functions
+const std::string& Dish::getName() const {
+    return StringPool::global().lookup(name_id_);
+}
+
+StringPool::Id Dish::getNameId() const {
+    return name_id_;
+}
+
+std::vector<std::string> Dish::getIngredients() const {
+    std::vector<std::string> ingredients;
+    ingredients.reserve(ingredient_count_);
+    for (std::uint32_t i = 0; i < ingredient_count_; ++i) {
+        ingredients.push_back(StringPool::global().lookup(ingredient_ids_[i]));
+    }
+    return ingredients;
+}
+
+int Dish::getIngredientCount() const {
+    return static_cast<int>(ingredient_count_);
+}
+
+const std::string& Dish::getIngredient(int index) const {
+    return StringPool::global().lookup(ingredient_ids_[index]);
+}
+
+StringPool::Id Dish::getIngredientId(int index) const {
+    return ingredient_ids_[index];
+}
+
+#endif
+
 int Dish::getPrepTime() const {
     return prep_time_;
 }
 
 double Dish::getPrice() const {
+    return price_.toDouble();
+}
+
+Price Dish::getPriceValue() const {
     return price_;
 }
 
 std::string Dish::getCuisineType() const {
-    switch (cuisine_type_) {
-        case CuisineType::ITALIAN: return "ITALIAN";
-        case CuisineType::MEXICAN: return "MEXICAN";
-        case CuisineType::CHINESE: return "CHINESE";
-        case CuisineType::INDIAN: return "INDIAN";
-        case CuisineType::AMERICAN: return "AMERICAN";
-        case CuisineType::FRENCH: return "FRENCH";
-        default: return "OTHER";
-    }
+    return std::string(getCuisineTypeName());
+}
+
+std::string_view Dish::getCuisineTypeName() const {
+    return cuisineTypeName(cuisine_type_);
+}
+
+Dish::CuisineType Dish::getCuisineTypeEnum() const {
+    return cuisine_type_;
+}
+
+bool Dish::isElaborate() const {
+    return elaborate_;
+}
+
+bool Dish::isElaborate(const ElaboratePolicy& policy) const {
+    return policy.isDefault() ? elaborate_ : policy.classify(getIngredientCount(), prep_time_);
+}
+
+void Dish::updateElaborate() {
+    elaborate_ = ElaboratePolicy().classify(getIngredientCount(), prep_time_);
+}
+
+bool Dish::stringToCuisineType(const std::string& cuisine_name, CuisineType& cuisine_type) {
+    return parseCuisineType(cuisine_name, cuisine_type);
 }
 
 // Mutator Functions
-void Dish::setName(const std::string& name) {
+#ifdef DISH_NO_STRING_POOL
+
+void Dish::setName(std::string name) {
     if (isValidName(name)) {
-        name_ = name;
+        name_ = std::move(name);
     } else {
         name_ = "UNKNOWN";
     }
 }
 
-void Dish::setIngredients(const std::vector<std::string>& ingredients) {
-    ingredients_ = ingredients;
+void Dish::setIngredients(std::vector<std::string> ingredients) {
+    ingredients_ = std::move(ingredients);
+    updateElaborate();
 }
 
+Dish Dish::fromFields(std::string_view name, const std::string_view* ingredients, std::size_t ingredient_count,
+                      int prep_time, Price price, CuisineType cuisine_type, IngredientListPool& pool) {
+    (void)pool;
+    Dish a_dish;
+    if (a_dish.isValidName(name)) {
+        a_dish.name_.assign(name.data(), name.size());
+    }
+    a_dish.ingredients_.reserve(ingredient_count);
+    for (std::size_t i = 0; i < ingredient_count; ++i) {
+        a_dish.ingredients_.emplace_back(ingredients[i]);
+    }
+    a_dish.prep_time_ = prep_time;
+    a_dish.price_ = price;
+    a_dish.cuisine_type_ = validCuisineType(cuisine_type);
+    a_dish.updateElaborate();
+    return a_dish;
+}
+
+void Dish::internIngredientsIn(IngredientListPool& pool) {
+    (void)pool;
+}
+
+#else
+
+void Dish::setName(std::string name) {
+    if (isValidName(name)) {
+        name_id_ = StringPool::global().intern(name);
+    } else {
+        name_id_ = unknownNameId();
+    }
+}
+
+void Dish::setIngredients(std::vector<std::string> ingredients) {
+    std::vector<StringPool::Id> ids;
+    ids.reserve(ingredients.size());
+    for (const std::string& ingredient : ingredients) {
+        ids.push_back(StringPool::global().intern(ingredient));
+    }
+    ingredient_ids_ = IngredientListPool::global().intern(ids.data(), ids.size());
+    ingredient_count_ = static_cast<std::uint32_t>(ids.size());
+    updateElaborate();
+}
+
+Dish Dish::fromFields(std::string_view name, const std::string_view* ingredients, std::size_t ingredient_count,
+                      int prep_time, Price price, CuisineType cuisine_type, IngredientListPool& pool) {
+    const std::size_t SMALL_LIST = 16;
+    StringPool::Id small_ids[SMALL_LIST];
+    std::vector<StringPool::Id> large_ids;
+    StringPool::Id* ids = small_ids;
+    if (ingredient_count > SMALL_LIST) {
+        large_ids.resize(ingredient_count);
+        ids = large_ids.data();
+    }
+    for (std::size_t i = 0; i < ingredient_count; ++i) {
+        ids[i] = StringPool::global().intern(ingredients[i]);
+    }
+
+    Dish a_dish;
+    if (a_dish.isValidName(name)) {
+        a_dish.name_id_ = StringPool::global().intern(name);
+    }
+    a_dish.ingredient_ids_ = pool.intern(ids, ingredient_count);
+    a_dish.ingredient_count_ = static_cast<std::uint32_t>(ingredient_count);
+    a_dish.prep_time_ = prep_time;
+    a_dish.price_ = price;
+    a_dish.cuisine_type_ = validCuisineType(cuisine_type);
+    a_dish.updateElaborate();
+    return a_dish;
+}
+
+void Dish::internIngredientsIn(IngredientListPool& pool) {
+    ingredient_ids_ = pool.intern(ingredient_ids_, ingredient_count_);
+}
+
+StringPool::Id Dish::unknownNameId() {
+    static const StringPool::Id unknown_id = StringPool::global().intern("UNKNOWN");
+    return unknown_id;
+}
+
+#endif
+
 void Dish::setPrepTime(const int& prep_time) {
     prep_time_ = prep_time;
+    updateElaborate();
 }
 
 void Dish::setPrice(const double& price) {
+    price_ = Price::fromDouble(price);
+}
+
+void Dish::setPrice(Price price) {
     price_ = price;
 }
 
 void Dish::setCuisineType(const CuisineType& cuisine_type) {
-    cuisine_type_ = cuisine_type;
+    cuisine_type_ = validCuisineType(cuisine_type);
 }
 
-// Display Function
+// Display Functions
 void Dish::display() const {
-    std::cout << "Dish Name: " << name_ << std::endl;
-    std::cout << "Ingredients: ";
-    for (size_t i = 0; i < ingredients_.size(); ++i) {
-        std::cout << ingredients_[i];
-        if (i != ingredients_.size() - 1) {
-            std::cout << ", ";
+    display(std::cout);
+}
+
+void Dish::display(std::ostream& out) const {
+    std::string buffer;
+    appendTo(buffer);
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+void Dish::appendTo(std::string& buffer) const {
+    buffer += "Dish Name: ";
+    buffer += getName();
+    buffer += "\nIngredients: ";
+    int ingredient_count = getIngredientCount();
+    for (int i = 0; i < ingredient_count; ++i) {
+        buffer += getIngredient(i);
+        if (i != ingredient_count - 1) {
+            buffer += ", ";
         }
     }
-    std::cout << std::endl;
-    std::cout << "Preparation Time: " << prep_time_ << " minutes" << std::endl;
-    std::cout << std::fixed << std::setprecision(2) << "Price: $" << price_ << std::endl;
-    std::cout << "Cuisine Type: " << getCuisineType() << std::endl;
+    buffer += "\nPreparation Time: ";
+    appendInteger(buffer, prep_time_);
+    buffer += " minutes\nPrice: $";
+    appendCents(buffer, price_.cents());
+    buffer += "\nCuisine Type: ";
+    buffer += getCuisineTypeName();
+    buffer += '\n';
 }
+
 bool Dish::operator==(const Dish& rhs) const
 {
-    return(name_ == rhs.getName() && cuisine_type_ == rhs.getCuisineType() && prep_time_ == rhs.getPrepTime() && price_ == rhs.getPrice());
+#ifdef DISH_NO_STRING_POOL
+    return(name_ == rhs.name_ && cuisine_type_ == rhs.cuisine_type_ && prep_time_ == rhs.prep_time_ && price_ == rhs.price_);
+#else
+    return(name_id_ == rhs.name_id_ && cuisine_type_ == rhs.cuisine_type_ && prep_time_ == rhs.prep_time_ && price_ == rhs.price_);
+#endif
 }
 
 bool Dish::operator!=(const Dish& rhs) const
@@ -105,9 +300,11 @@ bool Dish::operator!=(const Dish& rhs) const
 }
 
 // Helper function to check if the name is valid
-bool Dish::isValidName(const std::string& name) const {
+bool Dish::isValidName(std::string_view name) {
     for (char c : name) {
-        if (!std::isalpha(c) && !std::isspace(c)) {  // Check if each character is a letter or space
+        // The <cctype> functions are undefined for negative values other than EOF, e.g. UTF-8 bytes in a signed char
+        unsigned char byte = static_cast<unsigned char>(c);
+        if (!std::isalpha(byte) && !std::isspace(byte)) {  // Check if each character is a letter or space
             return false;  // Name contains non-alphabetic characters other than spaces
         }
     }
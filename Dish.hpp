@@ -5,6 +5,13 @@
  * The Dish class includes attributes such as name, ingredients, preparation time, price, and cuisine type.
  * It provides constructors, accessor and mutator functions, and a display function to manage and present
  * the details of a dish.
+ *
+ * By default the name and ingredients are interned in StringPool::global() and the dish stores only their Ids, so
+ * repeated strings are stored once and names compare by Id. The list of ingredient Ids is itself interned in
+ * an IngredientListPool, IngredientListPool::global() unless the dish was built for or stored in a kitchen, which
+ * keeps its dishes' lists in its own arena. A Dish therefore owns no heap memory and copying one never allocates, but a
+ * copy of a kitchen's dish refers to the kitchen's arena, see `Kitchen::resetArena`. Defining DISH_NO_STRING_POOL makes every dish keep its
+ * own strings instead. The public interface is the same either way.
  * 
  * @date [10/15/2024]
  * @author [Farhana Sultana]
@@ -13,16 +20,64 @@
 #ifndef DISH_HPP
 #define DISH_HPP
 
+#include <array>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <iostream>
 #include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include "ElaboratePolicy.hpp"
+#include "IngredientListPool.hpp"
+#include "Price.hpp"
+#include "StringPool.hpp"
 
 class Dish {
 public:
     // CuisineType enum definition
     enum CuisineType { ITALIAN, MEXICAN, CHINESE, INDIAN, AMERICAN, FRENCH, OTHER };
 
+    // Number of CuisineType values, usable as the size of an array indexed by CuisineType
+    static const int CUISINE_TYPE_COUNT = OTHER + 1;
+
+    // Names of the cuisine types, indexed by CuisineType. A new cuisine is added to the enum and to this table;
+    // the checks after the class fail to compile if the two disagree.
+    static constexpr std::array<std::string_view, CUISINE_TYPE_COUNT> CUISINE_TYPE_NAMES = {
+        "ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER" };
+
+    /**
+     * @param cuisine_type A CuisineType enum value, possibly cast from an integer outside the enum.
+     * @return The value itself if it is one of the enum's values, OTHER otherwise.
+     */
+    static constexpr CuisineType validCuisineType(CuisineType cuisine_type) {
+        return (cuisine_type >= 0 && cuisine_type < CUISINE_TYPE_COUNT) ? cuisine_type : OTHER;
+    }
+
+    /**
+     * @param cuisine_type A CuisineType enum value.
+     * @return The name of the cuisine type, e.g. "ITALIAN". Values outside the enum are named "OTHER".
+     */
+    static constexpr std::string_view cuisineTypeName(CuisineType cuisine_type) {
+        return CUISINE_TYPE_NAMES[validCuisineType(cuisine_type)];
+    }
+
+    /**
+     * Converts the name of a cuisine type to its CuisineType enum, at compile time if the name is a constant.
+     * @param cuisine_name A name from CUISINE_TYPE_NAMES. Only uppercase input will match.
+     * @param cuisine_type A reference to the CuisineType set to the matching enum value.
+     * @return True if the name matched one of the cuisine types, false otherwise (cuisine_type is left unchanged).
+     */
+    static constexpr bool parseCuisineType(std::string_view cuisine_name, CuisineType& cuisine_type) {
+        for (int i = 0; i < CUISINE_TYPE_COUNT; ++i) {
+            if (CUISINE_TYPE_NAMES[i] == cuisine_name) {
+                cuisine_type = static_cast<CuisineType>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
     // Constructors
     /**
      * Default constructor.
@@ -37,26 +92,56 @@ public:
 
     /**
      * Parameterized constructor.
-     * @param name A reference to the name of the dish.
-     * @param ingredients A reference to a list of ingredients (default is an empty list).
+     * @param name The name of the dish. It is moved into the dish, so passing a temporary does not copy it.
+     * @param ingredients A list of ingredients (default is an empty list). It is moved into the dish, so passing a temporary does not copy it.
      * @param prep_time The preparation time in minutes (default is 0).
-     * @param price The price of the dish (default is 0.0).
-     * @param cuisine_type The cuisine type of the dish (a CuisineType enum) with default value OTHER.
+     * @param price The price of the dish (default is 0.0), rounded to the nearest cent. NaN, infinite or out of range prices become 0.0.
+     * @param cuisine_type The cuisine type of the dish (a CuisineType enum) with default value OTHER. Values outside the enum become OTHER.
      * @post The private members are set to the values of the corresponding parameters.
      */
-    Dish(const std::string& name, const std::vector<std::string>& ingredients = {}, int prep_time = 0, double price = 0.0, CuisineType cuisine_type = CuisineType::OTHER);
+    Dish(std::string name, std::vector<std::string> ingredients = {}, int prep_time = 0, double price = 0.0, CuisineType cuisine_type = CuisineType::OTHER);
+
+    /**
+     * Checks if the name is valid.
+     * @param name The name to be validated, as bytes. Each byte is classified as an unsigned char in the current C
+     * locale, so in the default "C" locale the bytes of multi-byte UTF-8 characters are neither letters nor spaces.
+     * @return True if the name contains only alphabetic characters and spaces; false otherwise.
+     */
+    static bool isValidName(std::string_view name);
 
     // Accessors
     /**
-     * @return The name of the dish.
+     * @return A const reference to the name of the dish. It stays valid until the name is changed or the dish is destroyed.
+     */
+    const std::string& getName() const;
+
+    /**
+     * @return The Id of the name of the dish in StringPool::global().
      */
-    std::string getName() const;
+    StringPool::Id getNameId() const;
 
     /**
-     * @return The list of ingredients used in the dish.
+     * @return A copy of the list of ingredients used in the dish.
      */
     std::vector<std::string> getIngredients() const;
 
+    /**
+     * @return The number of ingredients used in the dish.
+     */
+    int getIngredientCount() const;
+
+    /**
+     * @param index The position of an ingredient, from 0 to getIngredientCount() - 1.
+     * @return A const reference to the ingredient at that position, without copying the list.
+     */
+    const std::string& getIngredient(int index) const;
+
+    /**
+     * @param index The position of an ingredient, from 0 to getIngredientCount() - 1.
+     * @return The Id of the ingredient at that position in StringPool::global().
+     */
+    StringPool::Id getIngredientId(int index) const;
+
     /**
      * @return The preparation time in minutes.
      */
@@ -67,25 +152,88 @@ public:
      */
     double getPrice() const;
 
+    /**
+     * @return The price of the dish in integer cents, as stored.
+     */
+    Price getPriceValue() const;
+
     /**
      * @return The cuisine type of the dish in string form.
      */
     std::string getCuisineType() const;
 
+    /**
+     * @return The cuisine type of the dish in string form, as a view of a string literal (no allocation).
+     */
+    std::string_view getCuisineTypeName() const;
+
+    /**
+     * @return The cuisine type of the dish as a CuisineType enum, without building a string. It is always one of
+     * the enum's values, so it can index an array of CUISINE_TYPE_COUNT entries.
+     */
+    CuisineType getCuisineTypeEnum() const;
+
+    /**
+     * @return True if the dish is elaborate under the default ElaboratePolicy. The classification is computed when
+     * the ingredients or preparation time change and cached, so this only reads a flag.
+     */
+    bool isElaborate() const;
+
+    /**
+     * @param policy A reference to the rule deciding whether a dish is elaborate.
+     * @return True if the dish is elaborate under the policy; the cached flag is used for the default policy.
+     */
+    bool isElaborate(const ElaboratePolicy& policy) const;
+
+    /**
+     * Converts the string form of a cuisine type to its CuisineType enum.
+     * @param cuisine_name A reference to a string with a value in
+     * ["ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER"]. Only uppercase input will match.
+     * @param cuisine_type A reference to the CuisineType set to the matching enum value.
+     * @return True if the string matched one of the cuisine types, false otherwise (cuisine_type is left unchanged).
+     */
+    static bool stringToCuisineType(const std::string& cuisine_name, CuisineType& cuisine_type);
+
+    /**
+     * Builds a dish from fields that view a caller's buffer, such as one row of an order file. In the default
+     * pooled mode the name and ingredients are interned straight from the views, without a std::string per field.
+     * @param name The name of the dish. An invalid name is replaced with "UNKNOWN", as in `setName`.
+     * @param ingredients A pointer to the first of `ingredient_count` ingredient views.
+     * @param ingredient_count The number of ingredients.
+     * @param prep_time The preparation time in minutes.
+     * @param price The price of the dish.
+     * @param cuisine_type The cuisine type of the dish. Values outside the enum become OTHER.
+     * @param pool The pool the ingredient list is interned in, e.g. the arena of the kitchen the dish is for.
+     * Unused with DISH_NO_STRING_POOL.
+     * @return The dish holding copies (or pooled Ids) of the fields.
+     */
+    static Dish fromFields(std::string_view name, const std::string_view* ingredients, std::size_t ingredient_count,
+                           int prep_time, Price price, CuisineType cuisine_type,
+                           IngredientListPool& pool = IngredientListPool::global());
+
     // Mutators
     /**
      * Sets the name of the dish.
-     * @param name A reference to the new name of the dish.
+     * @param name The new name of the dish, moved into the dish.
      * @post Sets the private member `name_` to the value of the parameter. If the name contains non-alphabetic characters, it is set to "UNKNOWN".
      */
-    void setName(const std::string& name);
+    void setName(std::string name);
 
     /**
      * Sets the list of ingredients.
-     * @param ingredients A reference to the new list of ingredients.
+     * @param ingredients The new list of ingredients, moved into the dish.
      * @post Sets the private member `ingredients_` to the value of the parameter.
      */
-    void setIngredients(const std::vector<std::string>& ingredients);
+    void setIngredients(std::vector<std::string> ingredients);
+
+    /**
+     * Moves the ingredient list to another pool.
+     * @param pool The pool the ingredient list is interned in from now on.
+     * @post The dish no longer refers to the pool its list was in before, so it stays valid when that pool is reset,
+     * e.g. a copy of a kitchen's dish kept past `Kitchen::resetArena` if `pool` is IngredientListPool::global(). Does
+     * nothing with DISH_NO_STRING_POOL.
+     */
+    void internIngredientsIn(IngredientListPool& pool);
 
     /**
      * Sets the preparation time.
@@ -96,15 +244,22 @@ public:
 
     /**
      * Sets the price of the dish.
-     * @param price The new price of the dish.
-     * @post Sets the private member `price_` to the value of the parameter.
+     * @param price The new price of the dish, rounded to the nearest cent.
+     * @post Sets the private member `price_` to the value of the parameter, or to 0.0 if it is NaN, infinite or out of range.
      */
     void setPrice(const double& price);
 
+    /**
+     * Sets the price of the dish.
+     * @param price The new price of the dish, in cents.
+     * @post Sets the private member `price_` to the value of the parameter.
+     */
+    void setPrice(Price price);
+
     /**
      * Sets the cuisine type of the dish.
      * @param cuisine_type The new cuisine type of the dish (a CuisineType enum).
-     * @post Sets the private member `cuisine_type_` to the value of the parameter.
+     * @post Sets the private member `cuisine_type_` to the value of the parameter, or to OTHER if it is outside the enum.
      */
     void setCuisineType(const CuisineType& cuisine_type);
     /**
@@ -136,20 +291,65 @@ public:
      */
     void display() const;
 
+    /**
+     * Writes the details of the dish, in the same format as `display()`, to the given stream.
+     * @param out A reference to the output stream.
+     * @post The text is built in a buffer and written with a single call, using '\n' rather than std::endl,
+     * so the stream is not flushed and its formatting flags are not changed.
+     */
+    void display(std::ostream& out) const;
+
+    /**
+     * Appends the details of the dish, in the same format as `display()`, to a caller-provided buffer.
+     * @param buffer A reference to the string the text is appended to.
+     */
+    void appendTo(std::string& buffer) const;
+
 private:
+#ifdef DISH_NO_STRING_POOL
     std::string name_;
     std::vector<std::string> ingredients_;
+#else
+    StringPool::Id name_id_;                      // Id of the name in StringPool::global()
+    std::uint32_t ingredient_count_;
+    const StringPool::Id* ingredient_ids_;        // Ids of the ingredients, pooled in an IngredientListPool
+#endif
     int prep_time_;
-    double price_;
+    Price price_;
     CuisineType cuisine_type_;
+    bool elaborate_;                              // classification under the default ElaboratePolicy
 
-    // Helper function to check if the name is valid
     /**
-     * Checks if the name is valid.
-     * @param name The name to be validated.
-     * @return True if the name contains only alphabetic characters and spaces; false otherwise.
+     * @post Recomputes `elaborate_` from the ingredient count and preparation time.
+     */
+    void updateElaborate();
+
+
+#ifndef DISH_NO_STRING_POOL
+    /**
+     * @return The Id of "UNKNOWN" in StringPool::global(), interned on first use.
      */
-    bool isValidName(const std::string& name) const;
+    static StringPool::Id unknownNameId();
+#endif
 };
 
+namespace dish_detail {
+
+// True if every CuisineType has a distinct, non-empty name that parses back to it
+constexpr bool cuisineTypeNamesRoundTrip() {
+    for (int i = 0; i < Dish::CUISINE_TYPE_COUNT; ++i) {
+        Dish::CuisineType parsed = Dish::OTHER;
+        if (Dish::CUISINE_TYPE_NAMES[i].empty() || !Dish::parseCuisineType(Dish::CUISINE_TYPE_NAMES[i], parsed) ||
+            parsed != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace dish_detail
+
+static_assert(dish_detail::cuisineTypeNamesRoundTrip(), "Dish::CUISINE_TYPE_NAMES must name every CuisineType once, in enum order");
+static_assert(Dish::cuisineTypeName(Dish::OTHER) == "OTHER", "OTHER must be the last CuisineType");
+
 #endif // DISH_HPP
@@ -0,0 +1,152 @@
+/**
+ * @file DishIndex.cpp
+ * @brief This file contains the implementation of the DishIndex class, a hash index over the dishes stored in a Kitchen.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "DishIndex.hpp"
+#include <functional>
+#include <string>
+
+// Combines a hash value into a running seed
+static void hashCombine(std::size_t& seed, std::size_t value) {
+    seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+std::size_t DishHash::operator()(const Dish& a_dish) const {
+#ifdef DISH_NO_STRING_POOL
+    std::size_t seed = std::hash<std::string>()(a_dish.getName());
+#else
+    std::size_t seed = std::hash<StringPool::Id>()(a_dish.getNameId());
+#endif
+    hashCombine(seed, std::hash<int>()(a_dish.getCuisineTypeEnum()));
+    hashCombine(seed, std::hash<int>()(a_dish.getPrepTime()));
+    hashCombine(seed, std::hash<Price::Cents>()(a_dish.getPriceValue().cents()));
+    return seed;
+}
+
+int DishIndex::findSlot(const Dish& a_dish, const Dish* items) const {
+    if (table_.empty()) {
+        return -1;
+    }
+    std::size_t hash = hasher_(a_dish);
+    std::size_t mask = table_.size() - 1;
+    for (std::size_t i = hash & mask; table_[i].slot != EMPTY_SLOT; i = (i + 1) & mask) {
+        if (table_[i].hash == hash && items[table_[i].slot] == a_dish) {
+            return table_[i].slot;
+        }
+    }
+    return -1;
+}
+
+int DishIndex::findSlot(const Dish& a_dish, const Dish* items, std::uint64_t& comparisons) const {
+    if (table_.empty()) {
+        return -1;
+    }
+    std::size_t hash = hasher_(a_dish);
+    std::size_t mask = table_.size() - 1;
+    for (std::size_t i = hash & mask; table_[i].slot != EMPTY_SLOT; i = (i + 1) & mask) {
+        if (table_[i].hash == hash) {
+            comparisons++;
+            if (items[table_[i].slot] == a_dish) {
+                return table_[i].slot;
+            }
+        }
+    }
+    return -1;
+}
+
+void DishIndex::insert(const Dish& a_dish, int slot) {
+    reserve(entry_count_ + 1);
+    std::size_t hash = hasher_(a_dish);
+    std::size_t mask = table_.size() - 1;
+    std::size_t i = hash & mask;
+    while (table_[i].slot != EMPTY_SLOT) {
+        i = (i + 1) & mask;
+    }
+    table_[i].hash = hash;
+    table_[i].slot = slot;
+    entry_count_++;
+}
+
+void DishIndex::erase(const Dish& a_dish, int slot) {
+    std::size_t hole = findEntry(hasher_(a_dish), slot);
+    if (hole == table_.size()) {
+        return;
+    }
+
+    // Shift later entries of the probe run back into the hole, so lookups never need tombstones
+    std::size_t mask = table_.size() - 1;
+    for (std::size_t next = (hole + 1) & mask; table_[next].slot != EMPTY_SLOT; next = (next + 1) & mask) {
+        std::size_t home = table_[next].hash & mask;
+        bool home_in_gap = hole <= next ? (hole < home && home <= next) : (hole < home || home <= next);
+        if (!home_in_gap) {
+            table_[hole] = table_[next];
+            hole = next;
+        }
+    }
+    table_[hole].slot = EMPTY_SLOT;
+    entry_count_--;
+}
+
+void DishIndex::moveSlot(const Dish& a_dish, int from_slot, int to_slot) {
+    std::size_t position = findEntry(hasher_(a_dish), from_slot);
+    if (position != table_.size()) {
+        table_[position].slot = to_slot;
+    }
+}
+
+void DishIndex::rebuild(const Dish* items, int count) {
+    // Keep the table's memory; the kitchen usually refills it
+    for (Entry& entry : table_) {
+        entry.slot = EMPTY_SLOT;
+    }
+    entry_count_ = 0;
+    reserve(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        insert(items[i], i);
+    }
+}
+
+void DishIndex::clear() {
+    std::vector<Entry>().swap(table_);
+    entry_count_ = 0;
+}
+
+std::size_t DishIndex::findEntry(std::size_t hash, int slot) const {
+    if (table_.empty()) {
+        return 0;
+    }
+    std::size_t mask = table_.size() - 1;
+    for (std::size_t i = hash & mask; table_[i].slot != EMPTY_SLOT; i = (i + 1) & mask) {
+        if (table_[i].slot == slot) {
+            return i;
+        }
+    }
+    return table_.size();
+}
+
+void DishIndex::reserve(std::size_t entry_count) {
+    if (entry_count * 2 <= table_.size()) {
+        return;
+    }
+    std::size_t new_size = table_.empty() ? MIN_TABLE_SIZE : table_.size();
+    while (entry_count * 2 > new_size) {
+        new_size *= 2;
+    }
+
+    std::vector<Entry> old_table(new_size, Entry{0, EMPTY_SLOT});
+    old_table.swap(table_);
+    std::size_t mask = new_size - 1;
+    for (const Entry& entry : old_table) {
+        if (entry.slot != EMPTY_SLOT) {
+            std::size_t i = entry.hash & mask;
+            while (table_[i].slot != EMPTY_SLOT) {
+                i = (i + 1) & mask;
+            }
+            table_[i] = entry;
+        }
+    }
+}
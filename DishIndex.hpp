@@ -0,0 +1,113 @@
+/**
+ * @file DishIndex.hpp
+ * @brief This file contains the declaration of the DishIndex class, a hash index over the dishes stored in a Kitchen.
+ *
+ * The DishIndex maps the hash of the fields used by Dish::operator== (name, cuisine type, preparation time and price)
+ * to the array slots holding dishes with that hash. It lets the Kitchen find an equal Dish in constant expected time
+ * instead of scanning its whole array. The index does not copy dishes; candidate slots are confirmed against the
+ * kitchen's own array with Dish::operator==.
+ *
+ * Entries live in one open-addressing table with linear probing, so once the table has grown to the kitchen's size
+ * inserting and erasing entries does not allocate.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef DISH_INDEX_HPP
+#define DISH_INDEX_HPP
+
+#include "Dish.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Hash functor over the fields compared by Dish::operator==.
+ */
+struct DishHash {
+    /**
+     * @param a_dish A reference to the dish to be hashed.
+     * @return A hash of the name, cuisine type, preparation time and price of the dish.
+     * Dishes that are equal under Dish::operator== hash to the same value.
+     */
+    std::size_t operator()(const Dish& a_dish) const;
+};
+
+class DishIndex {
+public:
+    /**
+     * @param a_dish A reference to the dish to be found.
+     * @param items A pointer to the array the slots of this index refer to.
+     * @return The slot of a dish equal to `a_dish`, or -1 if there is none.
+     */
+    int findSlot(const Dish& a_dish, const Dish* items) const;
+
+    /**
+     * Same as `findSlot(a_dish, items)`, for instrumented builds.
+     * @param comparisons A reference to a counter incremented once per Dish comparison made.
+     */
+    int findSlot(const Dish& a_dish, const Dish* items, std::uint64_t& comparisons) const;
+
+    /**
+     * @param a_dish A reference to the dish stored at `slot`.
+     * @param slot The array slot holding the dish.
+     * @post The slot is recorded under the hash of the dish.
+     */
+    void insert(const Dish& a_dish, int slot);
+
+    /**
+     * @param a_dish A reference to the dish stored at `slot`.
+     * @param slot The array slot holding the dish.
+     * @post The entry for the slot is removed from the index.
+     */
+    void erase(const Dish& a_dish, int slot);
+
+    /**
+     * @param a_dish A reference to the dish being moved.
+     * @param from_slot The slot the dish is currently recorded at.
+     * @param to_slot The slot the dish is moved to.
+     * @post The entry for the dish refers to `to_slot`.
+     */
+    void moveSlot(const Dish& a_dish, int from_slot, int to_slot);
+
+    /**
+     * @param items A pointer to the first dish.
+     * @param count The number of dishes in the array.
+     * @post The index is cleared and refilled with the slots 0 to count - 1.
+     */
+    void rebuild(const Dish* items, int count);
+
+    /**
+     * @post Removes all entries from the index and releases its memory.
+     */
+    void clear();
+
+private:
+    struct Entry {
+        std::size_t hash;
+        int slot;          // EMPTY_SLOT if the entry is unused
+    };
+
+    static const int EMPTY_SLOT = -1;
+    static const std::size_t MIN_TABLE_SIZE = 16;
+
+    std::vector<Entry> table_;  // size is 0 or a power of two, at most half full
+    std::size_t entry_count_ = 0;
+    DishHash hasher_;
+
+    /**
+     * @param hash The hash of a dish.
+     * @param slot The slot recorded for the dish.
+     * @return The position of the entry in table_, or table_.size() if there is none.
+     */
+    std::size_t findEntry(std::size_t hash, int slot) const;
+
+    /**
+     * @param entry_count The number of entries the table must hold.
+     * @post table_ has room for `entry_count` entries, rehashing into a larger table if needed.
+     */
+    void reserve(std::size_t entry_count);
+};
+
+#endif // DISH_INDEX_HPP
@@ -0,0 +1,58 @@
+/**
+ * @file ElaboratePolicy.hpp
+ * @brief This file contains the declaration of the ElaboratePolicy class, the rule deciding whether a dish is elaborate.
+ *
+ * A dish is elaborate if it has at least `min_ingredients` ingredients and a preparation time of at least
+ * `min_prep_time` minutes. Every Dish caches its classification under the default policy (5 ingredients, 60 minutes);
+ * a Kitchen may use other thresholds, see `Kitchen::setElaboratePolicy`.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef ELABORATE_POLICY_HPP
+#define ELABORATE_POLICY_HPP
+
+class ElaboratePolicy {
+public:
+    static constexpr int DEFAULT_MIN_INGREDIENTS = 5;
+    static constexpr int DEFAULT_MIN_PREP_TIME = 60;
+
+    /**
+     * @param min_ingredients The least number of ingredients of an elaborate dish.
+     * @param min_prep_time The least preparation time of an elaborate dish, in minutes.
+     */
+    constexpr explicit ElaboratePolicy(int min_ingredients = DEFAULT_MIN_INGREDIENTS,
+                                       int min_prep_time = DEFAULT_MIN_PREP_TIME)
+        : min_ingredients_(min_ingredients), min_prep_time_(min_prep_time) {}
+
+    constexpr int minIngredients() const { return min_ingredients_; }
+    constexpr int minPrepTime() const { return min_prep_time_; }
+
+    /**
+     * @return True if this is the default policy, the one Dish caches its classification under.
+     */
+    constexpr bool isDefault() const {
+        return min_ingredients_ == DEFAULT_MIN_INGREDIENTS && min_prep_time_ == DEFAULT_MIN_PREP_TIME;
+    }
+
+    /**
+     * @param ingredient_count The number of ingredients of a dish.
+     * @param prep_time The preparation time of the dish in minutes.
+     * @return True if a dish with these fields is elaborate under this policy.
+     */
+    constexpr bool classify(int ingredient_count, int prep_time) const {
+        return ingredient_count >= min_ingredients_ && prep_time >= min_prep_time_;
+    }
+
+    constexpr bool operator==(const ElaboratePolicy& rhs) const {
+        return min_ingredients_ == rhs.min_ingredients_ && min_prep_time_ == rhs.min_prep_time_;
+    }
+    constexpr bool operator!=(const ElaboratePolicy& rhs) const { return !(*this == rhs); }
+
+private:
+    int min_ingredients_;
+    int min_prep_time_;
+};
+
+#endif // ELABORATE_POLICY_HPP
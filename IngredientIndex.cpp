@@ -0,0 +1,156 @@
+/**
+ * @file IngredientIndex.cpp
+ * @brief This file contains the implementation of the IngredientIndex class, an inverted index from ingredients to
+ * the Kitchen slots of the dishes that use them.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "IngredientIndex.hpp"
+#include <algorithm>
+#include <cstddef>
+
+namespace {
+
+std::size_t wordsFor(int slot_count) {
+    return (static_cast<std::size_t>(slot_count) + 63) / 64;
+}
+
+int popcount64(std::uint64_t word) {
+    return __builtin_popcountll(word);
+}
+
+} // namespace
+
+void IngredientIndex::insert(const Dish& a_dish, int slot) {
+    for (int i = 0; i < a_dish.getIngredientCount(); ++i) {
+        setSlot(a_dish.getIngredientId(i), slot);
+    }
+}
+
+void IngredientIndex::erase(const Dish& a_dish, int slot) {
+    for (int i = 0; i < a_dish.getIngredientCount(); ++i) {
+        clearSlot(a_dish.getIngredientId(i), slot);
+    }
+}
+
+void IngredientIndex::moveSlot(const Dish& a_dish, int from_slot, int to_slot) {
+    for (int i = 0; i < a_dish.getIngredientCount(); ++i) {
+        StringPool::Id id = a_dish.getIngredientId(i);
+        clearSlot(id, from_slot);
+        setSlot(id, to_slot);
+    }
+}
+
+void IngredientIndex::rebuild(const Dish* items, int count) {
+    clear();
+    for (int slot = 0; slot < count; ++slot) {
+        insert(items[slot], slot);
+    }
+}
+
+void IngredientIndex::clear() {
+    // Keep the bitsets' storage; the same ingredients usually come back
+    for (Posting& posting : postings_) {
+        if (posting.count > 0) {
+            std::fill(posting.slots.begin(), posting.slots.end(), 0);
+            posting.count = 0;
+        }
+    }
+}
+
+int IngredientIndex::count(const std::string& ingredient) const {
+    const Posting* posting = findPosting(ingredient);
+    return posting ? posting->count : 0;
+}
+
+const IngredientIndex::SlotSet* IngredientIndex::slotsOf(const std::string& ingredient) const {
+    const Posting* posting = findPosting(ingredient);
+    return posting ? &posting->slots : nullptr;
+}
+
+IngredientIndex::SlotSet IngredientIndex::slotsWithAll(const std::vector<std::string>& ingredients, int slot_count) const {
+    std::size_t words = wordsFor(slot_count);
+    SlotSet result(words, ~std::uint64_t(0));
+    if (slot_count % 64 != 0) {
+        result.back() = (std::uint64_t(1) << (slot_count % 64)) - 1;
+    }
+    for (const std::string& ingredient : ingredients) {
+        const Posting* posting = findPosting(ingredient);
+        if (!posting) {
+            return SlotSet(words, 0);
+        }
+        std::size_t common = std::min(words, posting->slots.size());
+        for (std::size_t w = 0; w < common; ++w) {
+            result[w] &= posting->slots[w];
+        }
+        std::fill(result.begin() + common, result.end(), 0);
+    }
+    return result;
+}
+
+IngredientIndex::SlotSet IngredientIndex::slotsWithAny(const std::vector<std::string>& ingredients, int slot_count) const {
+    std::size_t words = wordsFor(slot_count);
+    SlotSet result(words, 0);
+    for (const std::string& ingredient : ingredients) {
+        const Posting* posting = findPosting(ingredient);
+        if (!posting) {
+            continue;
+        }
+        std::size_t common = std::min(words, posting->slots.size());
+        for (std::size_t w = 0; w < common; ++w) {
+            result[w] |= posting->slots[w];
+        }
+    }
+    return result;
+}
+
+int IngredientIndex::countSlots(const SlotSet& slots) {
+    int total = 0;
+    for (std::uint64_t word : slots) {
+        total += popcount64(word);
+    }
+    return total;
+}
+
+const IngredientIndex::Posting* IngredientIndex::findPosting(const std::string& ingredient) const {
+    StringPool::Id id;
+    // An ingredient that was never interned cannot be used by any dish
+    if (!StringPool::global().find(ingredient, id) || id >= postings_.size() || postings_[id].count == 0) {
+        return nullptr;
+    }
+    return &postings_[id];
+}
+
+void IngredientIndex::setSlot(StringPool::Id id, int slot) {
+    if (id >= postings_.size()) {
+        postings_.resize(static_cast<std::size_t>(id) + 1);
+    }
+    Posting& posting = postings_[id];
+    std::size_t word = static_cast<std::size_t>(slot) >> 6;
+    if (word >= posting.slots.size()) {
+        posting.slots.resize(std::max(word + 1, posting.slots.size() * 2), 0);
+    }
+    std::uint64_t bit = std::uint64_t(1) << (slot & 63);
+    if (!(posting.slots[word] & bit)) {
+        posting.slots[word] |= bit;
+        posting.count++;
+    }
+}
+
+void IngredientIndex::clearSlot(StringPool::Id id, int slot) {
+    if (id >= postings_.size()) {
+        return;
+    }
+    Posting& posting = postings_[id];
+    std::size_t word = static_cast<std::size_t>(slot) >> 6;
+    if (word >= posting.slots.size()) {
+        return;
+    }
+    std::uint64_t bit = std::uint64_t(1) << (slot & 63);
+    if (posting.slots[word] & bit) {
+        posting.slots[word] &= ~bit;
+        posting.count--;
+    }
+}
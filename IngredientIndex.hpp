@@ -0,0 +1,131 @@
+/**
+ * @file IngredientIndex.hpp
+ * @brief This file contains the declaration of the IngredientIndex class, an inverted index from ingredients to the
+ * Kitchen slots of the dishes that use them.
+ *
+ * Each ingredient, identified by its Id in StringPool::global(), owns a bitset with one bit per kitchen slot and a
+ * count of the bits set. Counting the dishes that use an ingredient is then a lookup, and "uses all of" / "uses any
+ * of" queries are word-wise AND / OR of the bitsets instead of a string search through every dish. Ids are dense, so
+ * the bitsets are kept in a vector indexed by Id.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef INGREDIENT_INDEX_HPP
+#define INGREDIENT_INDEX_HPP
+
+#include "Dish.hpp"
+#include "StringPool.hpp"
+#include <cstdint>
+#include <vector>
+
+class IngredientIndex {
+public:
+    /**
+     * One bit per kitchen slot, packed into 64-bit words. Bits past the last word are zero.
+     */
+    typedef std::vector<std::uint64_t> SlotSet;
+
+    /**
+     * @param a_dish A reference to the dish stored at `slot`.
+     * @param slot The kitchen slot of the dish.
+     * @post Sets the bit of `slot` for every ingredient of the dish.
+     */
+    void insert(const Dish& a_dish, int slot);
+
+    /**
+     * @param a_dish A reference to the dish stored at `slot`.
+     * @param slot The kitchen slot of the dish.
+     * @post Clears the bit of `slot` for every ingredient of the dish.
+     */
+    void erase(const Dish& a_dish, int slot);
+
+    /**
+     * @param a_dish A reference to the dish being moved.
+     * @param from_slot The slot the dish is moved from.
+     * @param to_slot The slot the dish is moved to.
+     */
+    void moveSlot(const Dish& a_dish, int from_slot, int to_slot);
+
+    /**
+     * @param items A pointer to the kitchen's array of dishes.
+     * @param count The number of dishes in the array.
+     * @post Rebuilds the index from the first `count` dishes in `items`.
+     */
+    void rebuild(const Dish* items, int count);
+
+    /**
+     * @post Removes every slot from the index.
+     */
+    void clear();
+
+    /**
+     * @param ingredient The ingredient to be counted.
+     * @return The number of dishes that use the ingredient.
+     */
+    int count(const std::string& ingredient) const;
+
+    /**
+     * @param ingredient An ingredient.
+     * @return A pointer to the slots of the dishes that use the ingredient, nullptr if there are none.
+     * The set may be shorter than the kitchen; missing words are zero.
+     */
+    const SlotSet* slotsOf(const std::string& ingredient) const;
+
+    /**
+     * @param ingredients A list of ingredients.
+     * @param slot_count The number of slots in the kitchen.
+     * @return The slots of the dishes that use every one of the ingredients. An empty list matches every slot.
+     */
+    SlotSet slotsWithAll(const std::vector<std::string>& ingredients, int slot_count) const;
+
+    /**
+     * @param ingredients A list of ingredients.
+     * @param slot_count The number of slots in the kitchen.
+     * @return The slots of the dishes that use at least one of the ingredients.
+     */
+    SlotSet slotsWithAny(const std::vector<std::string>& ingredients, int slot_count) const;
+
+    /**
+     * @param slots A set of slots.
+     * @return The number of slots in the set.
+     */
+    static int countSlots(const SlotSet& slots);
+
+    /**
+     * @param slots A set of slots.
+     * @param slot A slot.
+     * @return True if the slot is in the set.
+     */
+    static bool hasSlot(const SlotSet& slots, int slot) {
+        std::size_t word = static_cast<std::size_t>(slot) >> 6;
+        return word < slots.size() && ((slots[word] >> (slot & 63)) & 1u);
+    }
+
+private:
+    struct Posting {
+        SlotSet slots;
+        int count = 0;
+    };
+
+    std::vector<Posting> postings_; // indexed by StringPool::Id
+
+    /**
+     * @param ingredient An ingredient.
+     * @return A pointer to its posting, nullptr if no dish in the index uses it.
+     */
+    const Posting* findPosting(const std::string& ingredient) const;
+
+    /**
+     * @post Sets the bit of `slot` in the posting of `id`, growing the postings as needed.
+     */
+    void setSlot(StringPool::Id id, int slot);
+
+    /**
+     * @post Clears the bit of `slot` in the posting of `id`.
+     */
+    void clearSlot(StringPool::Id id, int slot);
+};
+
+#endif // INGREDIENT_INDEX_HPP
@@ -0,0 +1,71 @@
+/**
+ * @file IngredientListPool.cpp
+ * @brief This file contains the implementation of the IngredientListPool class, which interns the ingredient lists
+ * used by dishes.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "IngredientListPool.hpp"
+#include <algorithm>
+
+IngredientListPool::IngredientListPool() : block_used_(BLOCK_IDS), bytes_reserved_(0) {
+}
+
+const StringPool::Id* IngredientListPool::intern(const StringPool::Id* ids, std::size_t count) {
+    if (count == 0) {
+        return nullptr;
+    }
+
+    std::string_view bytes(reinterpret_cast<const char*>(ids), count * sizeof(StringPool::Id));
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto found = lists_.find(bytes);
+    if (found != lists_.end()) {
+        return reinterpret_cast<const StringPool::Id*>(found->data());
+    }
+
+    StringPool::Id* pooled;
+    if (count > BLOCK_IDS) {
+        std::unique_ptr<StringPool::Id[]> block(new StringPool::Id[count]);
+        pooled = block.get();
+        // Insert it before the open block, which keeps taking the short lists that follow
+        blocks_.insert(blocks_.empty() ? blocks_.end() : blocks_.end() - 1, std::move(block));
+        bytes_reserved_ += count * sizeof(StringPool::Id);
+    } else {
+        if (block_used_ + count > BLOCK_IDS) {
+            blocks_.emplace_back(new StringPool::Id[BLOCK_IDS]);
+            block_used_ = 0;
+            bytes_reserved_ += BLOCK_IDS * sizeof(StringPool::Id);
+        }
+        pooled = blocks_.back().get() + block_used_;
+        block_used_ += count;
+    }
+
+    std::copy(ids, ids + count, pooled);
+    lists_.emplace(reinterpret_cast<const char*>(pooled), count * sizeof(StringPool::Id));
+    return pooled;
+}
+
+void IngredientListPool::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lists_.clear();
+    blocks_.clear();
+    block_used_ = BLOCK_IDS;
+    bytes_reserved_ = 0;
+}
+
+int IngredientListPool::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int>(lists_.size());
+}
+
+std::size_t IngredientListPool::bytesReserved() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_reserved_;
+}
+
+IngredientListPool& IngredientListPool::global() {
+    static IngredientListPool pool;
+    return pool;
+}
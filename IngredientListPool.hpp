@@ -0,0 +1,83 @@
+/**
+ * @file IngredientListPool.hpp
+ * @brief This file contains the declaration of the IngredientListPool class, which interns the ingredient lists
+ * used by dishes.
+ *
+ * A dish's ingredients are a short list of StringPool Ids. Instead of each dish owning a heap-allocated vector of
+ * them, every distinct list is copied once into large blocks owned by the pool, and the dish keeps a pointer and a
+ * length. The blocks are never moved, and are freed only by `reset` or the pool's destruction, so a Dish is copied,
+ * moved and destroyed without touching the heap: adding dishes to a kitchen, serving them and compacting the kitchen
+ * allocate nothing, and only the first dish with a new ingredient list grows the pool.
+ *
+ * Every Kitchen owns a pool, its ingredient arena, holding the lists of the dishes it stores; `Kitchen::resetArena`
+ * frees it at the end of a shift. `global()` holds the lists of dishes built outside any kitchen, e.g. a menu, and
+ * lives as long as the process. `intern` may be called from several threads.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef INGREDIENT_LIST_POOL_HPP
+#define INGREDIENT_LIST_POOL_HPP
+
+#include "StringPool.hpp"
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+class IngredientListPool {
+public:
+    /**
+     * Default constructor.
+     * Creates an empty pool.
+     */
+    IngredientListPool();
+
+    IngredientListPool(const IngredientListPool&) = delete;
+    IngredientListPool& operator=(const IngredientListPool&) = delete;
+
+    /**
+     * @param ids A pointer to the first of `count` ingredient Ids.
+     * @param count The number of Ids in the list.
+     * @return A pointer to the pooled copy of the list, valid until the pool is reset or destroyed. Interning an equal
+     * list again returns the same pointer. An empty list is returned as nullptr.
+     * @post If the list was not in the pool, a copy of it is added.
+     */
+    const StringPool::Id* intern(const StringPool::Id* ids, std::size_t count);
+
+    /**
+     * @pre No dish whose ingredients were interned in this pool is used again, except by assigning to it or
+     * destroying it.
+     * @post Frees every list and block, leaving the pool empty. Must not run concurrently with `intern`.
+     */
+    void reset();
+
+    /**
+     * @return The number of distinct non-empty lists in the pool.
+     */
+    int size() const;
+
+    /**
+     * @return The number of bytes the pool has allocated for lists.
+     */
+    std::size_t bytesReserved() const;
+
+    /**
+     * @return The process-wide pool used by Dish.
+     */
+    static IngredientListPool& global();
+
+private:
+    static const std::size_t BLOCK_IDS = 4096;  // Ids per block; longer lists get a block of their own
+
+    std::vector<std::unique_ptr<StringPool::Id[]>> blocks_;
+    std::size_t block_used_;                  // Ids used in blocks_.back()
+    std::size_t bytes_reserved_;
+    std::unordered_set<std::string_view> lists_;  // bytes of each pooled list
+    mutable std::mutex mutex_;                // guards everything above
+};
+
+#endif // INGREDIENT_LIST_POOL_HPP
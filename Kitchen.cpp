@@ -10,14 +10,255 @@
  */
 
 #include "Kitchen.hpp"
+#include "KitchenSnapshot.hpp"
+#include <algorithm>
+#include <fstream>
+#include <limits>
 /**
  * Default constructor.
  * Default-initializes all private members.
  */
-Kitchen::Kitchen() : ArrayBag<Dish>(), total_prep_time_{0}, count_elaborate_{0} {
+Kitchen::Kitchen() : Kitchen(true) {
 
 }// end default constructor
 
+/**
+ * Parameterized constructor.
+ * @param : A boolean selecting whether the kitchen keeps a hash index of its dishes.
+ */
+Kitchen::Kitchen(bool use_dish_index)
+    : KitchenBag(), total_prep_time_{0}, total_revenue_{}, count_elaborate_{0}, elaborate_policy_{}, cuisine_counts_{}, use_dish_index_{use_dish_index},
+      ingredient_arena_{std::make_shared<IngredientListPool>()} {
+
+}// end parameterized constructor
+
+/**
+ * Move constructor.
+ * @param : A reference to the kitchen to be moved from, which is left empty.
+ */
+Kitchen::Kitchen(Kitchen&& other) : Kitchen(other.use_dish_index_)
+{
+    *this = std::move(other);
+}
+
+/**
+ * Copy assignment.
+ * @param : A reference to the kitchen to be copied from.
+ * @post : Same as move assignment from a copy of the given kitchen.
+ * @return : A reference to this kitchen.
+ */
+Kitchen& Kitchen::operator=(const Kitchen& other)
+{
+    if (this != &other)
+        *this = Kitchen(other);
+    return *this;
+}
+
+/**
+ * Move assignment.
+ * @param : A reference to the kitchen to be moved from.
+ * @post : Replaces the dishes, totals and indexes of the kitchen with those of the given
+ * kitchen, keeps the kitchen's observers and reports the change to them as one
+ * `kitchenCleared` followed by one `dishAdded` per slot. The kitchen shares the given
+ * kitchen's ingredient arena, and the given kitchen is left empty, as if by `clear`.
+ * @return : A reference to this kitchen.
+ */
+Kitchen& Kitchen::operator=(Kitchen&& other)
+{
+    if (this == &other)
+        return *this;
+
+    KitchenBag::operator=(std::move(other));
+    total_prep_time_ = other.total_prep_time_;
+    total_revenue_ = other.total_revenue_;
+    count_elaborate_ = other.count_elaborate_;
+    elaborate_policy_ = other.elaborate_policy_;
+    cuisine_counts_ = other.cuisine_counts_;
+    use_dish_index_ = other.use_dish_index_;
+    dish_index_ = std::move(other.dish_index_);
+    columns_ = std::move(other.columns_);
+    prep_time_index_ = std::move(other.prep_time_index_);
+    prep_time_sketch_ = std::move(other.prep_time_sketch_);
+    ingredient_index_ = std::move(other.ingredient_index_);
+    expiry_wheel_ = std::move(other.expiry_wheel_);
+    last_view_ = std::move(other.last_view_);
+    view_dirty_chunks_ = std::move(other.view_dirty_chunks_);
+    ingredient_arena_ = other.ingredient_arena_; // shared, so the moved-from kitchen keeps a usable arena
+    // observers_ and, with KITCHEN_INSTRUMENTATION, instrumentation_ belong to this kitchen and are kept
+    other.clear();
+
+    observers_.kitchenCleared();
+    for (int slot = 0; slot < item_count_; ++slot)
+        observers_.dishAdded(items_[slot], slot);
+    return *this;
+}
+
+/**
+ * @param : A boolean selecting whether the kitchen keeps a hash index of its dishes.
+ * @post : Enabling the index builds it from the dishes currently in the kitchen,
+ * disabling it releases its memory.
+ */
+void Kitchen::setDishIndexEnabled(bool use_dish_index)
+{
+    if (use_dish_index == use_dish_index_)
+        return;
+
+    use_dish_index_ = use_dish_index;
+    if (use_dish_index_)
+        dish_index_.rebuild(itemData(), item_count_);
+    else
+        dish_index_.clear();
+}
+
+/**
+ * @return : Returns true if the kitchen keeps a hash index of its dishes, false otherwise.
+ */
+bool Kitchen::isDishIndexEnabled() const
+{
+    return use_dish_index_;
+}
+
+/**
+ * @param : A reference to a `Dish`.
+ * @return : Returns true if a dish equal to the given `Dish` is in the kitchen, false otherwise.
+ */
+bool Kitchen::contains(const Dish& a_dish) const
+{
+    return findDish(a_dish) > -1;
+}
+
+/**
+ * @return : The number of dishes the kitchen can hold before its storage has to grow
+ * (or, with fixed capacity, at all).
+ */
+int Kitchen::getCapacity() const
+{
+#ifdef KITCHEN_FIXED_CAPACITY
+    return DEFAULT_CAPACITY;
+#else
+    return KitchenBag::getCapacity();
+#endif
+}
+
+/**
+ * @param : The number of dishes the kitchen should be able to hold.
+ * @post : Grows the storage to hold at least the given number of dishes.
+ * @return : Returns true if the kitchen can hold that many dishes, false if it has a fixed
+ * capacity that is too small.
+ */
+bool Kitchen::reserve(int capacity)
+{
+#ifdef KITCHEN_FIXED_CAPACITY
+    if (capacity > DEFAULT_CAPACITY)
+        return false;
+#else
+    KitchenBag::reserve(capacity);
+#endif
+    columns_.reserve(capacity);
+    expiry_wheel_.reserve(capacity);
+    return true;
+}
+
+/**
+ * @post : Releases storage beyond the dishes currently in the kitchen. Does nothing with
+ * fixed capacity.
+ */
+void Kitchen::shrinkToFit()
+{
+#ifndef KITCHEN_FIXED_CAPACITY
+    KitchenBag::shrinkToFit();
+#endif
+}
+
+/**
+ * @return : A reference to the kitchen's ingredient arena, the pool holding the ingredient
+ * lists of its dishes.
+ */
+IngredientListPool& Kitchen::getIngredientArena() const
+{
+    return *ingredient_arena_;
+}
+
+/**
+ * @post : Removes every dish, as `clear`, and frees the ingredient arena, or starts a new
+ * one if a copy of the kitchen or a view still shares it.
+ */
+void Kitchen::resetArena()
+{
+    clear();
+    if (ingredient_arena_.use_count() == 1)
+        ingredient_arena_->reset();
+    else
+        ingredient_arena_ = std::make_shared<IngredientListPool>();
+}
+
+/**
+ * @return : A const reference to the column view of the kitchen, holding the preparation
+ * time, price, cuisine type and elaborate flag of the dish in each slot of items_.
+ */
+const KitchenColumns& Kitchen::getColumns() const
+{
+    return columns_;
+}
+
+/**
+ * @param : The slot of a dish, from 0 to getCurrentSize() - 1.
+ * @return : A const reference to the dish stored in that slot of items_.
+ */
+const Dish& Kitchen::getDishAt(int slot) const
+{
+    return items_[slot];
+}
+
+/**
+ * @param : A reference to a `Dish`.
+ * @return : The slot of items_ holding a dish equal to the given `Dish`, or -1 if there is none.
+ */
+int Kitchen::getSlotOf(const Dish& a_dish) const
+{
+    return findDish(a_dish);
+}
+
+/**
+ * @param : A pointer to an observer notified of every later change to the kitchen.
+ */
+void Kitchen::addObserver(KitchenObserver* observer)
+{
+    observers_.add(observer);
+}
+
+/**
+ * @param : A pointer to an observer previously passed to `addObserver`.
+ * @post : The observer is no longer notified.
+ */
+void Kitchen::removeObserver(KitchenObserver* observer)
+{
+    observers_.remove(observer);
+}
+
+/**
+ * @post : Removes all dishes from the kitchen and resets the preparation time sum,
+ * elaborate count and cuisine counts.
+ */
+void Kitchen::clear()
+{
+    KitchenBag::clear();
+    total_prep_time_ = 0;
+    total_revenue_ = Price();
+    count_elaborate_ = 0;
+    cuisine_counts_.fill(0);
+    columns_.clear();
+    prep_time_index_.clear();
+    prep_time_sketch_.clear();
+    ingredient_index_.clear();
+    expiry_wheel_.clear();
+    last_view_.reset();
+    view_dirty_chunks_.clear();
+    if (use_dish_index_)
+        dish_index_.rebuild(itemData(), 0);
+    observers_.kitchenCleared();
+}
+
 /**
  * @param : A reference to a `Dish` being added to the kitchen.
  * @post : If the given `Dish` is not already in the kitchen, adds the
@@ -29,18 +270,40 @@ Kitchen::Kitchen() : ArrayBag<Dish>(), total_prep_time_{0}, count_elaborate_{0}
  */
 bool Kitchen::newOrder(const Dish& a_dish) 
 {
-    if(add(a_dish)) 
+    KITCHEN_INSTRUMENT_CALL(instrumentation_, KitchenInstrumentation::NEW_ORDER);
+    if (findDish(a_dish, KitchenInstrumentation::NEW_ORDER) > -1 || !makeRoomFor(item_count_ + 1))
     {
-        total_prep_time_ += a_dish.getPrepTime();
-        if(a_dish.getElaborateCount()) 
-            count_elaborate_++;
-        
-        return true;
+        return false;
     }
-    else
+
+    items_[item_count_] = a_dish;
+    items_[item_count_].internIngredientsIn(*ingredient_arena_);
+    KITCHEN_INSTRUMENT_MOVES(instrumentation_, KitchenInstrumentation::NEW_ORDER, 1);
+    recordAppended();
+
+    return true;
+}
+
+/**
+ * @param : A `Dish` being added to the kitchen, moved into the kitchen if it is added.
+ * @post : Same as `newOrder(const Dish&)`, except that the dish's name and ingredients are
+ * moved into the kitchen instead of copied. If the dish is not added, it is left unchanged.
+ * @return : Returns true if a `Dish` was successfully added to the kitchen, false otherwise.
+ */
+bool Kitchen::newOrder(Dish&& a_dish)
+{
+    KITCHEN_INSTRUMENT_CALL(instrumentation_, KitchenInstrumentation::NEW_ORDER);
+    if (findDish(a_dish, KitchenInstrumentation::NEW_ORDER) > -1 || !makeRoomFor(item_count_ + 1))
     {
         return false;
     }
+
+    items_[item_count_] = std::move(a_dish);
+    items_[item_count_].internIngredientsIn(*ingredient_arena_);
+    KITCHEN_INSTRUMENT_MOVES(instrumentation_, KitchenInstrumentation::NEW_ORDER, 1);
+    recordAppended();
+
+    return true;
 }
 /**
      * @param : A reference to a `Dish` leaving the kitchen.
@@ -50,37 +313,41 @@ bool Kitchen::newOrder(const Dish& a_dish)
      */
 bool Kitchen::serveDish(const Dish& a_dish) 
 {
-    if(remove(a_dish)) 
+    KITCHEN_INSTRUMENT_CALL(instrumentation_, KitchenInstrumentation::SERVE_DISH);
+    int slot = findDish(a_dish, KitchenInstrumentation::SERVE_DISH);
+    if (slot < 0)
     {
-        total_prep_time_ -= a_dish.getPrepTime();
-        if(a_dish.getElaborateDishCount())
-            count_elaborate_--;
-        
-        return true;
-    }
-    else
-    {
-    return false;
+        return false;
     }
+
+    removeAt(slot, KitchenObserver::SERVED);
+    return true;
 }
 /**
  * @return : The integer sum of preparation times for all the dishes currently in the kitchen.
  */
-int Kitchen::getPrepTimeSum() {
+int Kitchen::getPrepTimeSum() const {
     return total_prep_time_;
 }
+/**
+ * @return : The exact sum of the prices of all the dishes currently in the kitchen,
+ * kept as a running total in integer cents.
+ */
+Price Kitchen::totalRevenue() const {
+    return total_revenue_;
+}
 /**
  * @return : The average preparation time (int) of all the dishes in the
  * kitchen. The lowest possible average prep time should be 0.
  * @post : Computes the average preparation time (double) of the kitchen rounded to the NEAREST integer.
  */
-int Kitchen::calculateAvgPrepTime()
+int Kitchen::calculateAvgPrepTime() const
 {
-    return (total_prep_time_>0) ? round(double(total_prep_time_) / item_count_) : 0.0;
+    return KitchenStats::averagePrepTime(total_prep_time_, item_count_);
 }
 
 // Return the count of elaborate dishes in the kitchen
-int Kitchen::elaborateDishCount() {
+int Kitchen::elaborateDishCount() const {
     return count_elaborate_;
 }
 
@@ -90,11 +357,57 @@ int Kitchen::elaborateDishCount() {
  * @post : Computes the percentage of elaborate dishes in the kitchen
  * rounded up to 2 decimal places.
  */
-double Kitchen::calculateElaboratePercentage() 
+double Kitchen::calculateElaboratePercentage() const
+{
+    return KitchenStats::elaboratePercentage(count_elaborate_, item_count_);
+}
+
+/**
+ * @return : The rule the kitchen uses to decide whether a dish is elaborate,
+ * by default at least 5 ingredients and at least 60 minutes of preparation.
+ */
+const ElaboratePolicy& Kitchen::getElaboratePolicy() const
+{
+    return elaborate_policy_;
+}
+
+/**
+ * @param : A reference to the rule deciding whether a dish is elaborate.
+ * @post : Reclassifies the dishes in the kitchen from their preparation time and ingredient
+ * count columns, and adjusts the elaborate count by the dishes whose classification changed.
+ * The dishes and the indexes are not touched. Does nothing if the policy is unchanged.
+ */
+void Kitchen::setElaboratePolicy(const ElaboratePolicy& policy)
 {
-    double elaborate_percent = (count_elaborate_>0) ?  (double(count_elaborate_) / item_count_) * 100: 0.0;
-    return std::ceil(elaborate_percent*10000.0) / 100.0; //round up to 2 decimal places
+    if (policy == elaborate_policy_)
+        return;
 
+    elaborate_policy_ = policy;
+    count_elaborate_ += columns_.reclassifyElaborate(elaborate_policy_);
+}
+
+/**
+ * @return : The call counts, Dish comparisons, Dish moves and latency histograms of newOrder,
+ * serveDish, tallyCuisineTypes, the release functions and kitchenReport since the last reset.
+ * All zero unless built with KITCHEN_INSTRUMENTATION defined.
+ */
+KitchenInstrumentation::Snapshot Kitchen::instrumentationSnapshot() const
+{
+#ifdef KITCHEN_INSTRUMENTATION
+    return instrumentation_.snapshot();
+#else
+    return KitchenInstrumentation::Snapshot();
+#endif
+}
+
+/**
+ * @post : Sets the instrumentation counters of the kitchen to zero.
+ */
+void Kitchen::resetInstrumentation()
+{
+#ifdef KITCHEN_INSTRUMENTATION
+    instrumentation_.reset();
+#endif
 }
 
 /**
@@ -104,48 +417,151 @@ double Kitchen::calculateElaboratePercentage()
  * If the argument string does not match one of the expected cuisine types, the tally is zero.
  * NOTE: No pre-processing of the input string necessary, only uppercase input will match.
  */
-int Kitchen::tallyCuisineTypes(const std::string &cuisineType) 
+int Kitchen::tallyCuisineTypes(const std::string &cuisineType) const
 {
-  int frequency = 0;
-  int curr_index = 0;   
-  while (curr_index < item_count_)
+  Dish::CuisineType cuisine_type;
+  if (!Dish::stringToCuisineType(cuisineType, cuisine_type))
   {
-    if (items_[curr_index].getCuisineType() == cuisinetype)
-    {
-      frequency++;
-    } 
+    return 0;
+  }
 
-    curr_index++; 
+  return tallyCuisineTypes(cuisine_type);
+}
+
+/**
+ * @param : A CuisineType enum value.
+ * @return : An integer tally of the number of dishes in the kitchen of the given cuisine type,
+ * read from the running per-cuisine counts without scanning the kitchen. Values outside the enum
+ * tally zero, since every dish's cuisine type is one of the enum's values.
+ */
+int Kitchen::tallyCuisineTypes(Dish::CuisineType cuisineType) const
+{
+  KITCHEN_INSTRUMENT_CALL(instrumentation_, KitchenInstrumentation::TALLY_CUISINE_TYPES);
+  if (Dish::validCuisineType(cuisineType) != cuisineType)
+  {
+    return 0;
   }
 
-  return frequency;
+  return cuisine_counts_[cuisineType];
 }
 
+/**
+ * @return : The dish count, preparation time sum, revenue, elaborate count and cuisine counts
+ * recomputed by scanning the kitchen's columns, split across threads for kitchens of at least
+ * `KitchenParallel::serialThreshold()` dishes. They equal the running totals; the scan checks
+ * them, and its per-kitchen results can be added up for a view over several kitchens.
+ */
+KitchenColumns::Aggregates Kitchen::scanAggregates() const
+{
+  int worker_count = KitchenParallel::workerCount(item_count_);
+  std::vector<KitchenColumns::Aggregates> parts(worker_count);
+  KitchenParallel::forEachChunk(item_count_, worker_count, [this, &parts](int worker, int begin, int end) {
+    parts[worker] = columns_.aggregate(begin, end);
+  });
+
+  KitchenColumns::Aggregates totals;
+  for (const KitchenColumns::Aggregates& part : parts)
+    totals.add(part);
+  return totals;
+}
+
+/**
+ * @return : The kitchen's running totals and a sketch of its preparation times, kept up to
+ * date as dishes come and go, so this does not scan the kitchen. Statistics of several
+ * kitchens can be merged with `KitchenStats::merge` for a combined report.
+ */
+KitchenStats Kitchen::stats() const
+{
+  std::array<long long, Dish::CUISINE_TYPE_COUNT> cuisine_counts;
+  for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c)
+    cuisine_counts[c] = cuisine_counts_[c];
+  return KitchenStats(item_count_, total_prep_time_, total_revenue_, count_elaborate_, cuisine_counts,
+                      prep_time_sketch_);
+}
+
+/**
+ * @return : An immutable view of the kitchen's dishes and statistics as they are now, which
+ * stays valid and unchanged while the kitchen goes on, and may be read from other threads.
+ * Only the chunks of dishes changed since the previous view are copied; the others are
+ * shared with it, see KitchenView.hpp. The kitchen keeps the latest view for that purpose,
+ * so taking a view modifies the kitchen: it must be called from the thread that modifies
+ * the kitchen, or under the same lock, never concurrently with other calls on the kitchen.
+ */
+std::shared_ptr<const KitchenView> Kitchen::view()
+{
+  int chunk_count = (item_count_ + KitchenView::CHUNK_SIZE - 1) >> KitchenView::CHUNK_SHIFT;
+  std::vector<KitchenView::Chunk> chunks(chunk_count);
+  const Dish* items = itemData();
+  for (int c = 0; c < chunk_count; ++c)
+  {
+    int begin = c << KitchenView::CHUNK_SHIFT;
+    int end = std::min(item_count_, begin + KitchenView::CHUNK_SIZE);
+    // A chunk is shared unless one of its slots was written or the kitchen grew or shrank within it
+    if (last_view_ && c < static_cast<int>(view_dirty_chunks_.size()) && !view_dirty_chunks_[c]
+        && static_cast<int>(last_view_->chunks()[c]->size()) == end - begin)
+      chunks[c] = last_view_->chunks()[c];
+    else
+      chunks[c] = std::make_shared<const std::vector<Dish>>(items + begin, items + end);
+  }
+  last_view_ = std::make_shared<const KitchenView>(std::move(chunks), stats(),
+      std::vector<std::shared_ptr<const IngredientListPool>>{ ingredient_arena_ });
+  view_dirty_chunks_.assign(chunk_count, 0);
+  return last_view_;
+}
+
+
+/**
+ * @param : A preparation time threshold in minutes.
+ * @return : The number of dishes whose preparation time is less than the threshold,
+ * answered from the sorted preparation time index in O(log n), plus merging any updates
+ * the index has buffered since the last query. Safe to call from several threads at once,
+ * as long as no thread modifies the kitchen; the queries serialize on the index's mutex.
+ */
+int Kitchen::countDishesBelowPrepTime(int prepTimeThreshold) const
+{
+  return prep_time_index_.countBelow(prepTimeThreshold);
+}
+
+/**
+ * @param : The lower bound of the preparation time range in minutes, inclusive.
+ * @param : The upper bound of the preparation time range in minutes, inclusive.
+ * @return : The number of dishes whose preparation time lies in the range, in O(log n)
+ * plus merging buffered updates, as `countDishesBelowPrepTime`.
+ */
+int Kitchen::countDishesInPrepTimeRange(int minPrepTime, int maxPrepTime) const
+{
+  return prep_time_index_.countInRange(minPrepTime, maxPrepTime);
+}
+
+/**
+ * @param : A percentage from 0 to 100, e.g. 50 for the median or 95 for p95.
+ * @return : The nearest-rank percentile of the preparation times in the kitchen, 0 if it is empty,
+ * in O(log n) plus merging buffered updates, as `countDishesBelowPrepTime`.
+ */
+int Kitchen::prepTimePercentile(double percent) const
+{
+  return prep_time_index_.percentile(percent);
+}
 
 /**
 * @param : A reference to an integer representing the preparation time
 * threshold of the dishes to be removed from the kitchen.
 * @post : Removes all dishes from the kitchen whose preparation time is
-* less than the given time.
+* less than the given time. Returns in O(log n) from the preparation time index when no
+* dish qualifies. Otherwise the removal keeps the order of the remaining dishes, so it is a
+* compaction of the whole bag: O(n), not O(k log n) for the k dishes removed.
 * @return : The number of dishes removed from the kitchen.
 */
 int Kitchen::releaseDishesBelowPrepTime(int threshold) {
-    int removedCount = 0;
-    int i,j;
-
-    for (i = 0; i < getCurrentSize(); ++i) {
-        if (items_[i].getPrepTime() < threshold){
-            // Shift all to the left
-            for (j = i; j < getCurrentSize()-1; ++j) {
-                items_[j] = items_[j+1];
-            }
-            item_count_--;
-            removedCount++;
-            i--;
-        }
+    KITCHEN_INSTRUMENT_CALL(instrumentation_, KitchenInstrumentation::RELEASE);
+    if (prep_time_index_.countBelow(threshold) == 0) {
+        return 0;
     }
 
-    return removedCount;
+    std::vector<std::uint8_t> remove_mask(item_count_);
+    columns_.markPrepTimeBelow(threshold, remove_mask.data());
+
+    return releaseMarked(remove_mask, KitchenObserver::RELEASED);
 }
 
 /**
@@ -159,21 +575,130 @@ int Kitchen::releaseDishesBelowPrepTime(int threshold) {
      *
      */
 int Kitchen::releaseDishesOfCuisineType(const std::string &cuisine_type){
-    int removed_count = 0;
-    int i,j;
-    for (i = 0; i < getCurrentSize(); ++i) {
-        if (items_[i].getCuisineType() == cuisine_type){
-            // Shift all to the left
-            for (j = i; j < getCurrentSize()-1; ++j) {
-                items_[j] = items_[j+1];
-            }
-            item_count_--;
-            removed_count++;
-            i--;
-        }
+    KITCHEN_INSTRUMENT_CALL(instrumentation_, KitchenInstrumentation::RELEASE);
+    Dish::CuisineType type;
+    if (!Dish::stringToCuisineType(cuisine_type, type)) {
+        return 0;
     }
 
-    return removed_count;
+    if (cuisine_counts_[type] == 0) {
+        return 0;
+    }
+
+    std::vector<std::uint8_t> remove_mask(item_count_);
+    columns_.markCuisineType(type, remove_mask.data());
+    return releaseMarked(remove_mask, KitchenObserver::RELEASED);
+}
+
+/**
+ * @param : A reference to a string naming an ingredient.
+ * @return : The number of dishes in the kitchen that use the ingredient, from the
+ * ingredient index without looking at the dishes.
+ */
+int Kitchen::tallyIngredient(const std::string& ingredient) const
+{
+  return ingredient_index_.count(ingredient);
+}
+
+/**
+ * @param : A list of ingredients.
+ * @return : The number of dishes in the kitchen that use every one of the ingredients,
+ * computed as an intersection of the ingredients' slot bitsets.
+ */
+int Kitchen::tallyDishesContainingAll(const std::vector<std::string>& ingredients) const
+{
+  return IngredientIndex::countSlots(ingredient_index_.slotsWithAll(ingredients, item_count_));
+}
+
+/**
+ * @param : A list of ingredients.
+ * @return : The number of dishes in the kitchen that use at least one of the ingredients,
+ * computed as a union of the ingredients' slot bitsets.
+ */
+int Kitchen::tallyDishesContainingAny(const std::vector<std::string>& ingredients) const
+{
+  return IngredientIndex::countSlots(ingredient_index_.slotsWithAny(ingredients, item_count_));
+}
+
+/**
+ * @param : A reference to a string naming an ingredient, e.g. one that ran out.
+ * @post : Removes all dishes from the kitchen that use the ingredient. The remaining
+ * dishes keep their relative order.
+ * @return : The number of dishes removed from the kitchen.
+ */
+int Kitchen::releaseDishesContaining(const std::string& ingredient)
+{
+  KITCHEN_INSTRUMENT_CALL(instrumentation_, KitchenInstrumentation::RELEASE);
+  const IngredientIndex::SlotSet* slots = ingredient_index_.slotsOf(ingredient);
+  if (slots == nullptr)
+    return 0;
+  return releaseSlots(IngredientIndex::SlotSet(*slots));
+}
+
+/**
+ * @param : A list of ingredients, e.g. a set of allergens.
+ * @post : Removes all dishes from the kitchen that use at least one of the ingredients.
+ * The remaining dishes keep their relative order.
+ * @return : The number of dishes removed from the kitchen.
+ */
+int Kitchen::releaseDishesContainingAny(const std::vector<std::string>& ingredients)
+{
+  KITCHEN_INSTRUMENT_CALL(instrumentation_, KitchenInstrumentation::RELEASE);
+  return releaseSlots(ingredient_index_.slotsWithAny(ingredients, item_count_));
+}
+
+/**
+ * @param : How long an order may wait before it expires, in the time unit of `expireOrders`,
+ * e.g. seconds. 0 or less means dishes never expire, which is the default.
+ * @post : Every dish, including those already in the kitchen, now expires at its order time
+ * plus the new TTL. Dishes whose expiry time has passed go at the next `expireOrders`.
+ */
+void Kitchen::setOrderTtl(std::int64_t ttl)
+{
+  expiry_wheel_.setTtl(ttl);
+}
+
+/**
+ * @return : The time to live of an order, 0 if dishes never expire.
+ */
+std::int64_t Kitchen::getOrderTtl() const
+{
+  return expiry_wheel_.ttl();
+}
+
+/**
+ * @return : The kitchen clock: the last time passed to `expireOrders`, 0 before the first
+ * call. New orders are stamped with it.
+ */
+std::int64_t Kitchen::getCurrentTime() const
+{
+  return expiry_wheel_.currentTime();
+}
+
+/**
+ * @param : The slot of a dish, from 0 to getCurrentSize() - 1.
+ * @return : The time the dish was ordered, the kitchen clock when it was added.
+ */
+std::int64_t Kitchen::getOrderTime(int slot) const
+{
+  return expiry_wheel_.orderTime(slot);
+}
+
+/**
+ * @param : The current time, in the unit of the TTL. Times before the kitchen clock are ignored.
+ * @post : Advances the kitchen clock and removes every dish whose order time plus TTL is at
+ * most the given time, oldest expiry first. As in `serveDish`, the slot of each dish removed
+ * is filled with the last dish in the kitchen. The running totals and indexes are updated and
+ * the observers are told of each removal as a release. The dishes to remove are found in a
+ * timing wheel, see OrderExpiryWheel.hpp, so this costs O(dishes removed) rather than a scan.
+ * @return : The number of dishes removed from the kitchen.
+ */
+int Kitchen::expireOrders(std::int64_t now)
+{
+  KITCHEN_INSTRUMENT_CALL(instrumentation_, KitchenInstrumentation::RELEASE);
+  return expiry_wheel_.advance(now, [this](int slot) {
+    removeAt(slot, KitchenObserver::RELEASED);
+  });
 }
 
 /**
@@ -196,24 +721,503 @@ int Kitchen::releaseDishesOfCuisineType(const std::string &cuisine_type){
      */
 void Kitchen::kitchenReport()
 {
-  int italian = tallyCuisineType("ITALIAN");
-  int mexican = tallyCuisineType("MEXICAN");
-  int chinese = tallyCuisineType("CHINESE");
-  int indian = tallyCuisineType("INDIAN");
-  int american = tallyCuisineType("AMERICAN");
-  int french = tallyCuisineType("FRENCH");
-  int other = tallyCuisineType("OTHER");
-    
-  std::cout << "ITALIAN: " << italian << std::endl;
-  std::cout << "MEXICAN: " << mexican << std::endl;
-  std::cout << "CHINESE: " << chinese << std::endl;
-  std::cout << "INDIAN: " << indian << std::endl;
-  std::cout << "AMERICAN: " << american << std::endl;
-  std::cout << "FRENCH: " << french << std::endl;
-  std::cout << "OTHER: " << other << std::endl;
-  std::cout << "\nAVERAGE PREP TIME: " << calculateAvgPrepTime() << std::endl;
-  std::cout << "ELABORATE DISHES: " << std::fixed << std::setprecision(2) << calculateElaboratePercentage() << "%.\n\n";
+  kitchenReport(std::cout);
+}
+
+/**
+ * @param : A reference to the output stream the report is written to.
+ * @post : Writes the report described in `kitchenReport()` to the stream with a single
+ * write, using '\n' rather than std::endl and leaving the stream's formatting flags unchanged.
+ */
+void Kitchen::kitchenReport(std::ostream& out) const
+{
+  KITCHEN_INSTRUMENT_CALL(instrumentation_, KitchenInstrumentation::KITCHEN_REPORT);
+  std::string buffer;
+  appendReport(buffer);
+  out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+/**
+ * @param : A reference to the string the report described in `kitchenReport()` is appended to.
+ */
+void Kitchen::appendReport(std::string& buffer) const
+{
+  std::array<long long, Dish::CUISINE_TYPE_COUNT> cuisine_counts;
+  for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c)
+    cuisine_counts[c] = cuisine_counts_[c];
+  KitchenStats::appendReport(buffer, cuisine_counts, total_prep_time_, count_elaborate_, item_count_);
+}
+
+/**
+ * @param : A reference to the output stream the dishes are written to.
+ * @post : Writes every dish in the kitchen, in the format of `Dish::display()` and in kitchen
+ * order, to the stream with a single buffered write.
+ */
+void Kitchen::dumpDishes(std::ostream& out) const
+{
+  std::string buffer;
+  appendDishes(buffer);
+  out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+/**
+ * @param : A reference to the string every dish in the kitchen is appended to, in the
+ * format of `Dish::display()` and in kitchen order.
+ */
+void Kitchen::appendDishes(std::string& buffer) const
+{
+  const int BYTES_PER_DISH_ESTIMATE = 128;
+  buffer.reserve(buffer.size() + static_cast<std::size_t>(item_count_) * BYTES_PER_DISH_ESTIMATE);
+  for (int i = 0; i < item_count_; ++i)
+  {
+    items_[i].appendTo(buffer);
+  }
+}
+
+/**
+ * @param : A reference to a binary output stream.
+ * @post : Writes a binary snapshot of the dishes and running totals, see KitchenSnapshot.hpp.
+ * @return : Returns true if the whole snapshot was written, false otherwise.
+ */
+bool Kitchen::saveSnapshot(std::ostream& out) const
+{
+  KitchenSnapshotWriter writer;
+  for (int i = 0; i < item_count_; ++i)
+  {
+    writer.addDish(items_[i], columns_.isElaborate(i));
+  }
+  writer.setTotals(total_prep_time_, total_revenue_, count_elaborate_, cuisine_counts_);
+  return writer.writeTo(out);
+}
+
+/**
+ * @param : The path of the snapshot file to create or replace.
+ * @return : Returns true if the whole snapshot was written, false otherwise.
+ */
+bool Kitchen::saveSnapshot(const std::string& path) const
+{
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out || !saveSnapshot(out))
+    return false;
+  out.close();
+  return !out.fail();
+}
+
+/**
+ * @param : A reference to an open snapshot view, e.g. of a file mapped with `KitchenSnapshotView::open`.
+ * @post : Replaces the contents of the kitchen with the dishes in the snapshot, in snapshot order.
+ * The running totals are taken from the header, which opening the view checked against the
+ * records, and the elaborate flags are checked against the kitchen's elaborate policy, which
+ * may differ from the policy of the kitchen that saved the snapshot. The kitchen is left
+ * unchanged if the view is not open, the dishes do not fit, their preparation times add up to
+ * more than an int, or a dish has an invalid name or equals another (see
+ * `KitchenSnapshotView::hasDistinctValidDishes`).
+ * @return : Returns true if the kitchen was restored, false otherwise.
+ */
+bool Kitchen::restoreSnapshot(const KitchenSnapshotView& snapshot)
+{
+  if (!snapshot.isOpen() || !makeRoomFor(snapshot.dishCount()) || !snapshot.hasDistinctValidDishes())
+    return false;
+
+  // Opening the view checked the header totals against the records, so they seed the running totals
+  const KitchenSnapshotHeader& header = snapshot.header();
+  if (header.total_prep_time < std::numeric_limits<int>::min() ||
+      header.total_prep_time > std::numeric_limits<int>::max())
+    return false;
+
+  clear();
+  columns_.reserve(snapshot.dishCount());
+  expiry_wheel_.reserve(snapshot.dishCount());
+  for (int i = 0; i < snapshot.dishCount(); ++i)
+  {
+    items_[item_count_] = snapshot.dishAt(i, *ingredient_arena_);
+    if (use_dish_index_)
+      dish_index_.insert(items_[item_count_], item_count_);
+    ingredient_index_.insert(items_[item_count_], item_count_);
+    columns_.pushBack(items_[item_count_], snapshot.record(i).elaborate != 0);
+    prep_time_index_.insert(columns_.getPrepTime(item_count_));
+    prep_time_sketch_.insert(columns_.getPrepTime(item_count_));
+    expiry_wheel_.pushBack(expiry_wheel_.currentTime());
+    if (!observers_.empty())
+      observers_.dishAdded(items_[item_count_], item_count_);
+    item_count_++;
+  }
+
+  total_prep_time_ = static_cast<int>(header.total_prep_time);
+  total_revenue_ = Price::fromCents(header.total_revenue_cents);
+  count_elaborate_ = header.elaborate_count + columns_.reclassifyElaborate(elaborate_policy_);
+  std::copy(header.cuisine_counts, header.cuisine_counts + Dish::CUISINE_TYPE_COUNT, cuisine_counts_.begin());
+  return true;
+}
+
+/**
+ * @param : A reference to a `Dish`.
+ * @return : Returns true if the dish is elaborate under the kitchen's elaborate policy,
+ * false otherwise. Under the default policy this reads the flag cached in the dish.
+ */
+bool Kitchen::isElaborate(const Dish& a_dish) const
+{
+    return a_dish.isElaborate(elaborate_policy_);
+}
+
+/**
+ * @return : A pointer to the first element of items_.
+ */
+const Dish* Kitchen::itemData() const
+{
+#ifdef KITCHEN_FIXED_CAPACITY
+    return items_;
+#else
+    return items_.get();
+#endif
+}
+
+/**
+ * @param : A slot of items_ about to be written.
+ * @post : The chunk of the latest view holding the slot, if any, is copied again by the next `view()`.
+ */
+void Kitchen::markViewChanged(int slot)
+{
+    std::size_t chunk = static_cast<std::size_t>(slot) >> KitchenView::CHUNK_SHIFT;
+    if (chunk < view_dirty_chunks_.size())
+        view_dirty_chunks_[chunk] = 1;
+}
+
+/**
+ * @param : The first slot of a run of slots about to be written.
+ * @param : The slot after the run.
+ * @post : Same as `markViewChanged(int)` for every slot of the run.
+ */
+void Kitchen::markViewChanged(int begin_slot, int end_slot)
+{
+    if (begin_slot >= end_slot)
+        return;
+    std::size_t first_chunk = static_cast<std::size_t>(begin_slot) >> KitchenView::CHUNK_SHIFT;
+    std::size_t last_chunk = static_cast<std::size_t>(end_slot - 1) >> KitchenView::CHUNK_SHIFT;
+    for (std::size_t chunk = first_chunk; chunk <= last_chunk && chunk < view_dirty_chunks_.size(); ++chunk)
+        view_dirty_chunks_[chunk] = 1;
+}
+
+/**
+ * @param : The number of dishes that must fit in the kitchen.
+ * @post : Grows the storage geometrically if needed.
+ * @return : Returns true if that many dishes fit, false if the capacity is fixed and too small.
+ */
+bool Kitchen::makeRoomFor(int count)
+{
+#ifdef KITCHEN_FIXED_CAPACITY
+    return count <= DEFAULT_CAPACITY;
+#else
+    ensureCapacity(count);
+    return true;
+#endif
+}
+
+/**
+ * @pre : The dish has just been written to items_[item_count_].
+ * @post : The dish becomes part of the kitchen: it is indexed, counted and added to the running totals.
+ */
+void Kitchen::recordAppended()
+{
+    markViewChanged(item_count_);
+    if (use_dish_index_)
+        dish_index_.insert(items_[item_count_], item_count_);
+    ingredient_index_.insert(items_[item_count_], item_count_);
+    columns_.pushBack(items_[item_count_], isElaborate(items_[item_count_]));
+    expiry_wheel_.pushBack(expiry_wheel_.currentTime());
+    recordAdded(item_count_);
+    if (!observers_.empty())
+        observers_.dishAdded(items_[item_count_], item_count_);
+    item_count_++;
+}
+
+/**
+ * @param : The first slot of a run of dishes appended to items_ and columns_, ending at item_count_.
+ * @post : Adds the whole run to the running totals at once.
+ */
+void Kitchen::recordAppendedRange(int first_slot)
+{
+    const int* prep_times = columns_.prepTimes();
+    const Price::Cents* price_cents = columns_.priceCents();
+    const std::uint8_t* cuisine_types = columns_.cuisineTypes();
+    const std::uint8_t* elaborate_flags = columns_.elaborateFlags();
+    int prep_time_sum = 0;
+    Price::Cents revenue_cents = 0;
+    int elaborate_count = 0;
+    for (int slot = first_slot; slot < item_count_; ++slot)
+    {
+        prep_time_sum += prep_times[slot];
+        revenue_cents += price_cents[slot];
+        prep_time_index_.insert(prep_times[slot]);
+        prep_time_sketch_.insert(prep_times[slot]);
+        expiry_wheel_.pushBack(expiry_wheel_.currentTime());
+        elaborate_count += elaborate_flags[slot];
+        cuisine_counts_[cuisine_types[slot]]++;
+    }
+    total_prep_time_ += prep_time_sum;
+    total_revenue_ += Price::fromCents(revenue_cents);
+    count_elaborate_ += elaborate_count;
+}
+
+/**
+ * @param : A mask with one byte per slot, nonzero for the slots to be removed.
+ * @param : The number of nonzero bytes in the mask.
+ * @post : Removes the marked dishes, individually if there are few of them, with one
+ * compaction pass otherwise.
+ */
+void Kitchen::removeMarked(const std::vector<std::uint8_t>& remove_mask, int marked_count)
+{
+    // Below this fraction of the kitchen, swapping each dish with the last one beats a full pass
+    const int FEW_REMOVALS_DIVISOR = 16;
+    if (marked_count == 0)
+        return;
+
+    if (marked_count * FEW_REMOVALS_DIVISOR >= item_count_)
+    {
+        releaseMarked(remove_mask, KitchenObserver::SERVED);
+        return;
+    }
+
+    // Highest slots first, so the last dish moved into a hole is never one still to be removed
+    for (int slot = item_count_ - 1; slot >= 0 && marked_count > 0; --slot)
+    {
+        if (remove_mask[slot])
+        {
+            removeAt(slot, KitchenObserver::SERVED);
+            marked_count--;
+        }
+    }
+}
+
+/**
+ * @param : A reference to a `Dish`.
+ * @return : The slot in items_ of a dish equal to the given `Dish`, or -1 if there is none.
+ */
+int Kitchen::findDish(const Dish& a_dish) const
+{
+    if (use_dish_index_)
+        return dish_index_.findSlot(a_dish, itemData());
+    return getIndexOf(a_dish);
 }
 
+/**
+ * @param : A reference to a `Dish`.
+ * @param : The instrumented operation the Dish comparisons of the search are counted for.
+ * @return : Same as `findDish(a_dish)`.
+ */
+int Kitchen::findDish(const Dish& a_dish, KitchenInstrumentation::Operation operation) const
+{
+#ifdef KITCHEN_INSTRUMENTATION
+    std::uint64_t comparisons = 0;
+    int slot;
+    if (use_dish_index_)
+    {
+        slot = dish_index_.findSlot(a_dish, itemData(), comparisons);
+    }
+    else
+    {
+        slot = getIndexOf(a_dish);
+        comparisons = (slot < 0) ? item_count_ : slot + 1; // the bag scans from the first slot
+    }
+    instrumentation_.addComparisons(operation, comparisons);
+    return slot;
+#else
+    (void)operation;
+    return findDish(a_dish);
+#endif
+}
 
+/**
+ * @param : Why dishes are removed.
+ * @return : The instrumented operation the removal belongs to.
+ */
+KitchenInstrumentation::Operation Kitchen::removalOperation(KitchenObserver::RemovalReason reason)
+{
+    return reason == KitchenObserver::SERVED ? KitchenInstrumentation::SERVE_DISH : KitchenInstrumentation::RELEASE;
+}
 
+/**
+ * @param : The slot in items_ of the dish to be removed.
+ * @param : Why the dish is removed, passed on to the observers.
+ * @post : Updates the running totals, then fills the slot with the last dish in the kitchen.
+ */
+void Kitchen::removeAt(int slot, KitchenObserver::RemovalReason reason)
+{
+    int last_slot = item_count_ - 1;
+    recordRemoved(slot);
+    if (!observers_.empty())
+    {
+        observers_.dishRemoved(items_[slot], slot, reason);
+        if (slot != last_slot)
+            observers_.dishMoved(items_[last_slot], last_slot, slot);
+    }
+    if (use_dish_index_)
+    {
+        dish_index_.erase(items_[slot], slot);
+        if (slot != last_slot)
+            dish_index_.moveSlot(items_[last_slot], last_slot, slot);
+    }
+    ingredient_index_.erase(items_[slot], slot);
+    if (slot != last_slot)
+        ingredient_index_.moveSlot(items_[last_slot], last_slot, slot);
+    expiry_wheel_.erase(slot);
+
+    if (slot != last_slot)
+    {
+        markViewChanged(slot);
+        items_[slot] = std::move(items_[last_slot]);
+        columns_.moveSlot(last_slot, slot);
+        expiry_wheel_.moveSlot(last_slot, slot);
+        KITCHEN_INSTRUMENT_MOVES(instrumentation_, removalOperation(reason), 1);
+    }
+    columns_.truncate(last_slot);
+    expiry_wheel_.truncate(last_slot);
+    item_count_--;
+}
+
+/**
+ * @param : The slot of a dish added to the kitchen, already present in columns_.
+ * @post : Adds the dish to the preparation time sum, revenue, elaborate count and cuisine counts.
+ */
+void Kitchen::recordAdded(int slot)
+{
+    total_prep_time_ += columns_.getPrepTime(slot);
+    total_revenue_ += Price::fromCents(columns_.getPriceCents(slot));
+    prep_time_index_.insert(columns_.getPrepTime(slot));
+    prep_time_sketch_.insert(columns_.getPrepTime(slot));
+    if (columns_.isElaborate(slot))
+        count_elaborate_++;
+    cuisine_counts_[columns_.getCuisineType(slot)]++;
+}
+
+/**
+ * @param : The slot of a dish being removed from the kitchen, still present in columns_.
+ * @post : Removes the dish from the preparation time sum, revenue, elaborate count and cuisine counts.
+ */
+void Kitchen::recordRemoved(int slot)
+{
+    total_prep_time_ -= columns_.getPrepTime(slot);
+    total_revenue_ -= Price::fromCents(columns_.getPriceCents(slot));
+    prep_time_index_.erase(columns_.getPrepTime(slot));
+    prep_time_sketch_.erase(columns_.getPrepTime(slot));
+    if (columns_.isElaborate(slot))
+        count_elaborate_--;
+    cuisine_counts_[columns_.getCuisineType(slot)]--;
+}
+
+/**
+ * @param : A mask with one byte per slot, nonzero for the slots to be removed.
+ * @param : Why the dishes are removed, passed on to the observers.
+ * @return : The number of dishes removed, see `compactIf`.
+ */
+int Kitchen::releaseMarked(const std::vector<std::uint8_t>& remove_mask, KitchenObserver::RemovalReason reason)
+{
+    // Observers are told of every removal and move in slot order, which only the serial pass does
+    int worker_count = KitchenParallel::workerCount(item_count_);
+    if (worker_count > 1 && observers_.empty())
+        return compactMarkedParallel(remove_mask, reason, worker_count);
+
+    return compactIf([&remove_mask](int slot) {
+        return remove_mask[slot] != 0;
+    }, reason);
+}
+
+/**
+ * @param : A mask with one byte per slot, nonzero for the slots to be removed.
+ * @param : Why the dishes are removed.
+ * @param : The number of workers, at least 2.
+ * @post : Removes the marked dishes like `compactIf`, keeping the others in order, but with the
+ * scans and moves split across workers. The indexes are rebuilt rather than updated slot by
+ * slot. Observers are not notified, so this is only used when there are none.
+ * @return : The number of dishes removed.
+ */
+int Kitchen::compactMarkedParallel(const std::vector<std::uint8_t>& remove_mask, KitchenObserver::RemovalReason reason,
+                                   int worker_count)
+{
+    // Pass 1: the totals of the removed dishes and the first removed slot of each chunk
+    std::vector<KitchenColumns::Aggregates> removed(worker_count);
+    std::vector<int> first_removed(worker_count);
+    KitchenParallel::forEachChunk(item_count_, worker_count, [&](int worker, int begin, int end) {
+        removed[worker] = columns_.aggregateMarked(begin, end, remove_mask.data());
+        int slot = begin;
+        while (slot < end && !remove_mask[slot])
+            slot++;
+        first_removed[worker] = slot;
+    });
+
+    KitchenColumns::Aggregates removed_totals;
+    for (const KitchenColumns::Aggregates& part : removed)
+        removed_totals.add(part);
+    if (removed_totals.dish_count == 0)
+        return 0;
+
+    total_prep_time_ -= static_cast<int>(removed_totals.prep_time_sum);
+    total_revenue_ -= Price::fromCents(removed_totals.price_cents_sum);
+    count_elaborate_ -= removed_totals.elaborate_count;
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c)
+        cuisine_counts_[c] -= removed_totals.cuisine_counts[c];
+    for (int slot = 0; slot < item_count_; ++slot)
+    {
+        if (remove_mask[slot])
+        {
+            prep_time_index_.erase(columns_.getPrepTime(slot));
+            prep_time_sketch_.erase(columns_.getPrepTime(slot));
+        }
+    }
+
+    // Dishes before the first removed slot stay where they are. Each chunk's survivors from there on
+    // go to a scratch buffer at an offset given by the survivors of the chunks before it, then back to
+    // items_, so no chunk writes slots that another chunk is still reading.
+    int keep_until = *std::min_element(first_removed.begin(), first_removed.end());
+    std::vector<int> offsets(worker_count + 1, 0);
+    for (int worker = 0; worker < worker_count; ++worker)
+    {
+        int begin = std::max(keep_until, KitchenParallel::chunkBegin(item_count_, worker_count, worker));
+        int end = std::max(begin, KitchenParallel::chunkBegin(item_count_, worker_count, worker + 1));
+        offsets[worker + 1] = offsets[worker] + (end - begin) - removed[worker].dish_count;
+    }
+    int moved_count = offsets[worker_count];
+    int new_count = keep_until + moved_count;
+
+    expiry_wheel_.compactMarked(remove_mask.data());
+    std::vector<Dish> survivors(moved_count);
+    KitchenParallel::forEachChunk(item_count_, worker_count, [&](int worker, int begin, int end) {
+        int next = offsets[worker];
+        for (int slot = std::max(begin, keep_until); slot < end; ++slot)
+        {
+            if (!remove_mask[slot])
+                survivors[next++] = std::move(items_[slot]);
+        }
+    });
+
+    columns_.truncate(new_count);
+    markViewChanged(keep_until, new_count);
+    KitchenParallel::forEachChunk(moved_count, worker_count, [&](int, int begin, int end) {
+        for (int i = begin; i < end; ++i)
+        {
+            int slot = keep_until + i;
+            items_[slot] = std::move(survivors[i]);
+            columns_.setSlot(slot, items_[slot], isElaborate(items_[slot]));
+        }
+    });
+    KITCHEN_INSTRUMENT_MOVES(instrumentation_, removalOperation(reason), 2 * moved_count);
+    (void)reason;
+
+    item_count_ = new_count;
+    if (use_dish_index_)
+        dish_index_.rebuild(itemData(), item_count_);
+    ingredient_index_.rebuild(itemData(), item_count_);
+    return removed_totals.dish_count;
+}
+
+/**
+ * @param : A set with one bit per slot, set for the slots to be removed. It must not be
+ * the index's own set, which changes while the dishes are removed.
+ * @return : The number of dishes removed, see `compactIf`.
+ */
+int Kitchen::releaseSlots(const IngredientIndex::SlotSet& slots)
+{
+    return compactIf([&slots](int slot) {
+        return IngredientIndex::hasSlot(slots, slot);
+    }, KitchenObserver::RELEASED);
+}
@@ -1,10 +1,16 @@
 /**
  * @file Kitchen.hpp
- * @brief This file contains the declaration of the Kitchen class, which inherits from ArrayBag<Dish>.
+ * @brief This file contains the declaration of the Kitchen class, which privately inherits from KitchenBag.
  *
  * The Kitchen class is responsible for managing a collection of Dish objects in a virtual kitchen. It includes methods
  * for adding and removing dishes, calculating preparation times, counting elaborate dishes, and generating kitchen reports.
  *
+ * KitchenBag is the storage the Kitchen inherits from. By default it is a ResizableArrayBag<Dish>, which grows as orders
+ * arrive. The inheritance is private, so the bag's own `add` and `remove`, which would bypass the columns, indexes and
+ * totals the Kitchen keeps for every slot, cannot be called on a Kitchen; only its read-only queries are public.
+ * Defining KITCHEN_FIXED_CAPACITY selects the fixed-size ArrayBag<Dish> instead, in which case `newOrder` returns false
+ * once the kitchen is full.
+ *
  * @date [10/15/2014]
  * @author [Farhana Sultana]
  */
@@ -12,14 +18,45 @@
 #ifndef DISH_KITCHEN_HPP
 #define DISH_KITCHEN_HPP
 
+#ifdef KITCHEN_FIXED_CAPACITY
 #include "ArrayBag.hpp"
+#else
+#include "ResizableArrayBag.hpp"
+#endif
 #include "Dish.hpp"
+#include "DishIndex.hpp"
+#include "ElaboratePolicy.hpp"
+#include "IngredientIndex.hpp"
+#include "IngredientListPool.hpp"
+#include "KitchenColumns.hpp"
+#include "KitchenInstrumentation.hpp"
+#include "KitchenObserver.hpp"
+#include "KitchenParallel.hpp"
+#include "KitchenStats.hpp"
+#include "KitchenView.hpp"
+#include "OrderExpiryWheel.hpp"
+#include "PrepTimeIndex.hpp"
+#include "PrepTimeSketch.hpp"
+#include "Price.hpp"
+#include <array>
+#include <cstdint>
 #include <vector>
 #include <iostream>
 #include <cmath>
 #include <iomanip>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#ifdef KITCHEN_FIXED_CAPACITY
+typedef ArrayBag<Dish> KitchenBag;
+#else
+typedef ResizableArrayBag<Dish> KitchenBag;
+#endif
 
-class Kitchen: public ArrayBag<Dish>{
+class KitchenSnapshotView;
+
+class Kitchen: private KitchenBag{
 public:
     /**
      * Default constructor.
@@ -27,6 +64,138 @@ public:
      */
      Kitchen();
 
+    /**
+     * Parameterized constructor.
+     * @param : A boolean selecting whether the kitchen keeps a hash index of its dishes.
+     * With the index, duplicate checks in `newOrder`, `contains` and `serveDish` take constant
+     * expected time; without it they scan the kitchen and no extra memory is used.
+     */
+     explicit Kitchen(bool use_dish_index);
+
+    /**
+     * Copy and move constructors.
+     * @param : A reference to the kitchen to be copied or moved from.
+     * @post : The new kitchen holds the same dishes, totals and indexes, and has no observers.
+     * It shares the ingredient arena of the given kitchen. A moved-from kitchen is left empty.
+     */
+     Kitchen(const Kitchen& other) = default;
+     Kitchen(Kitchen&& other);
+
+    /**
+     * Copy and move assignment.
+     * @param : A reference to the kitchen to be copied or moved from.
+     * @post : Replaces the dishes, totals and indexes of the kitchen with those of the given
+     * kitchen. The kitchen keeps its own observers, which are notified of the change as if by
+     * `clear` followed by adding each new dish: one `kitchenCleared`, then one `dishAdded` per
+     * slot in slot order. The kitchen then shares the ingredient arena of the given kitchen.
+     * A moved-from kitchen is left empty, as if by `clear`.
+     * @return : A reference to this kitchen.
+     */
+     Kitchen& operator=(const Kitchen& other);
+     Kitchen& operator=(Kitchen&& other);
+
+    /**
+     * @param : A boolean selecting whether the kitchen keeps a hash index of its dishes.
+     * @post : Enabling the index builds it from the dishes currently in the kitchen,
+     * disabling it releases its memory.
+     */
+     void setDishIndexEnabled(bool use_dish_index);
+
+    /**
+     * @return : Returns true if the kitchen keeps a hash index of its dishes, false otherwise.
+     */
+     bool isDishIndexEnabled() const;
+
+    /**
+     * @param : A reference to a `Dish`.
+     * @return : Returns true if a dish equal to the given `Dish` is in the kitchen, false otherwise.
+     */
+     bool contains(const Dish& a_dish) const;
+
+    /**
+     * The read-only queries of KitchenBag. Dishes are added and removed only through `newOrder`,
+     * `serveDish` and the release functions, which keep every structure mirroring the slots in step.
+     */
+     using KitchenBag::getCurrentSize;
+     using KitchenBag::isEmpty;
+     using KitchenBag::getFrequencyOf;
+     using KitchenBag::toVector;
+
+    /**
+     * @return : The number of dishes the kitchen can hold before its storage has to grow
+     * (or, with fixed capacity, at all).
+     */
+     int getCapacity() const;
+
+    /**
+     * @param : The number of dishes the kitchen should be able to hold.
+     * @post : Grows the storage to hold at least the given number of dishes, so a bulk load
+     * does not reallocate repeatedly.
+     * @return : Returns true if the kitchen can hold that many dishes, false if it has a fixed
+     * capacity that is too small.
+     */
+     bool reserve(int capacity);
+
+    /**
+     * @post : Releases storage beyond the dishes currently in the kitchen. Does nothing with
+     * fixed capacity.
+     */
+     void shrinkToFit();
+
+    /**
+     * @return : A reference to the kitchen's ingredient arena, the pool holding the ingredient
+     * lists of its dishes. Every dish stored in the kitchen has its list interned there; dishes
+     * built for the kitchen, e.g. by `Dish::fromFields`, can be interned there straight away.
+     * Copies of the kitchen and its views share the arena.
+     */
+     IngredientListPool& getIngredientArena() const;
+
+    /**
+     * @post : Ends a shift: removes every dish, as `clear`, and frees the ingredient arena, so
+     * the memory of the shift's ingredient lists is returned at once. If a copy of the kitchen
+     * or a view still shares the arena, the kitchen starts a new arena instead and the old one
+     * is freed with its last user. Dishes copied out of the kitchen, e.g. by `getDishAt` or
+     * `toVector`, refer to the arena and must not be used after it is freed, unless they were
+     * moved to another pool with `Dish::internIngredientsIn`.
+     */
+     void resetArena();
+
+    /**
+     * @return : A const reference to the column view of the kitchen, holding the preparation
+     * time, price, cuisine type and elaborate flag of the dish in each slot of items_.
+     */
+     const KitchenColumns& getColumns() const;
+
+    /**
+     * @param : The slot of a dish, from 0 to getCurrentSize() - 1.
+     * @return : A const reference to the dish stored in that slot of items_.
+     */
+     const Dish& getDishAt(int slot) const;
+
+    /**
+     * @param : A reference to a `Dish`.
+     * @return : The slot of items_ holding a dish equal to the given `Dish`, or -1 if there is none.
+     */
+     int getSlotOf(const Dish& a_dish) const;
+
+    /**
+     * @param : A pointer to an observer notified of every later change to the kitchen. The
+     * observer must outlive the kitchen or be removed first.
+     */
+     void addObserver(KitchenObserver* observer);
+
+    /**
+     * @param : A pointer to an observer previously passed to `addObserver`.
+     * @post : The observer is no longer notified.
+     */
+     void removeObserver(KitchenObserver* observer);
+
+    /**
+     * @post : Removes all dishes from the kitchen and resets the preparation time sum,
+     * elaborate count and cuisine counts.
+     */
+     void clear();
+
     /**
      * @param : A reference to a `Dish` being added to the kitchen.
      * @post : If the given `Dish` is not already in the kitchen, adds the
@@ -38,6 +207,14 @@ public:
      */
      bool newOrder(const Dish& a_dish);
 
+    /**
+     * @param : A `Dish` being added to the kitchen, moved into the kitchen if it is added.
+     * @post : Same as `newOrder(const Dish&)`, except that the dish's name and ingredients are
+     * moved into the kitchen instead of copied. If the dish is not added, it is left unchanged.
+     * @return : Returns true if a `Dish` was successfully added to the kitchen, false otherwise.
+     */
+     bool newOrder(Dish&& a_dish);
+
     /**
      * @param : A reference to a `Dish` leaving the kitchen.
      * @return : Returns true if a dish was successfully removed from the kitchen (i.e.,items_), false otherwise.
@@ -46,22 +223,49 @@ public:
      */
      bool serveDish(const Dish& a_dish);
 
+    /**
+     * @param : A pair of forward iterators delimiting the dishes to be added. Pass
+     * std::move_iterator's to move the dishes into the kitchen instead of copying them.
+     * @post : Adds every dish in the range that is not already in the kitchen (or earlier in the
+     * range), in range order. Capacity is reserved once for the whole range, duplicates are found
+     * through the hash index (a temporary one if the kitchen's index is disabled), and the running
+     * totals are updated once for the batch.
+     * @return : One flag per dish in the range, true if that dish was added.
+     */
+     template<class ForwardIterator>
+     std::vector<bool> newOrders(ForwardIterator first, ForwardIterator last);
+
+    /**
+     * @param : A pair of forward iterators delimiting the dishes to be served.
+     * @post : Removes one dish equal to each dish in the range. All dishes are looked up first,
+     * then removed together in a single pass over the kitchen.
+     * @return : One flag per dish in the range, true if an equal dish was found and removed.
+     */
+     template<class ForwardIterator>
+     std::vector<bool> serveDishes(ForwardIterator first, ForwardIterator last);
+
     /**
      * @return : The integer sum of preparation times for all the dishes currently in the kitchen.
      */
-    int getPrepTimeSum();
+    int getPrepTimeSum() const;
+
+    /**
+     * @return : The exact sum of the prices of all the dishes currently in the kitchen,
+     * kept as a running total in integer cents.
+     */
+    Price totalRevenue() const;
 
     /**
      * @return : The average preparation time (int) of all the dishes in the
      * kitchen. The lowest possible average prep time should be 0.
      * @post : Computes the average preparation time (double) of the kitchen rounded to the NEAREST integer.
      */
-    int calculateAvgPrepTime();
+    int calculateAvgPrepTime() const;
 
     /**
      * @return : The integer count of the elaborate dishes in the kitchen.
      */
-     int elaborateDishCount();
+     int elaborateDishCount() const;
 
     /**
      * @return : The percentage (double) of all the elaborate dishes in the
@@ -69,7 +273,33 @@ public:
      * @post : Computes the percentage of elaborate dishes in the kitchen
      * rounded up to 2 decimal places.
      */
-    double calculateElaboratePercentage();
+    double calculateElaboratePercentage() const;
+
+    /**
+     * @return : The rule the kitchen uses to decide whether a dish is elaborate,
+     * by default at least 5 ingredients and at least 60 minutes of preparation.
+     */
+    const ElaboratePolicy& getElaboratePolicy() const;
+
+    /**
+     * @param : A reference to the rule deciding whether a dish is elaborate.
+     * @post : Reclassifies the dishes in the kitchen from their preparation time and ingredient
+     * count columns, and adjusts the elaborate count by the dishes whose classification changed.
+     * The dishes and the indexes are not touched. Does nothing if the policy is unchanged.
+     */
+    void setElaboratePolicy(const ElaboratePolicy& policy);
+
+    /**
+     * @return : The call counts, Dish comparisons, Dish moves and latency histograms of newOrder,
+     * serveDish, tallyCuisineTypes, the release functions and kitchenReport since the last reset.
+     * All zero unless built with KITCHEN_INSTRUMENTATION defined.
+     */
+    KitchenInstrumentation::Snapshot instrumentationSnapshot() const;
+
+    /**
+     * @post : Sets the instrumentation counters of the kitchen to zero.
+     */
+    void resetInstrumentation();
 
 
     /**
@@ -79,13 +309,73 @@ public:
      * If the argument string does not match one of the expected cuisine types, the tally is zero.
      * NOTE: No pre-processing of the input string necessary, only uppercase input will match.
      */
-    int tallyCuisineTypes(const std::string& cuisineType);
+    int tallyCuisineTypes(const std::string& cuisineType) const;
+
+    /**
+     * @param : A CuisineType enum value.
+     * @return : An integer tally of the number of dishes in the kitchen of the given cuisine type,
+     * read from the running per-cuisine counts without scanning the kitchen. Values outside the enum
+     * tally zero, since every dish's cuisine type is one of the enum's values.
+     */
+    int tallyCuisineTypes(Dish::CuisineType cuisineType) const;
+
+    /**
+     * @return : The dish count, preparation time sum, revenue, elaborate count and cuisine counts
+     * recomputed by scanning the kitchen's columns, split across threads for kitchens of at least
+     * `KitchenParallel::serialThreshold()` dishes. They equal the running totals; the scan checks
+     * them, and its per-kitchen results can be added up for a view over several kitchens.
+     */
+    KitchenColumns::Aggregates scanAggregates() const;
+
+    /**
+     * @return : The kitchen's running totals and a sketch of its preparation times, kept up to
+     * date as dishes come and go, so this does not scan the kitchen. Statistics of several
+     * kitchens can be merged with `KitchenStats::merge` for a combined report.
+     */
+    KitchenStats stats() const;
+
+    /**
+     * @return : An immutable view of the kitchen's dishes and statistics as they are now, which
+     * stays valid and unchanged while the kitchen goes on, and may be read from other threads.
+     * Only the chunks of dishes changed since the previous view are copied; the others are
+     * shared with it, see KitchenView.hpp. The kitchen keeps the latest view for that purpose,
+     * so taking a view modifies the kitchen: it must be called from the thread that modifies
+     * the kitchen, or under the same lock, never concurrently with other calls on the kitchen.
+     */
+    std::shared_ptr<const KitchenView> view();
+
+    /**
+     * @param : A preparation time threshold in minutes.
+     * @return : The number of dishes whose preparation time is less than the threshold,
+     * answered from the sorted preparation time index in O(log n), plus merging any updates
+     * the index has buffered since the last query. Safe to call from several threads at once,
+     * as long as no thread modifies the kitchen; the queries serialize on the index's mutex.
+     */
+    int countDishesBelowPrepTime(int prepTimeThreshold) const;
+
+    /**
+     * @param : The lower bound of the preparation time range in minutes, inclusive.
+     * @param : The upper bound of the preparation time range in minutes, inclusive.
+     * @return : The number of dishes whose preparation time lies in the range, in O(log n)
+     * plus merging buffered updates, as `countDishesBelowPrepTime`.
+     */
+    int countDishesInPrepTimeRange(int minPrepTime, int maxPrepTime) const;
+
+    /**
+     * @param : A percentage from 0 to 100, e.g. 50 for the median or 95 for p95.
+     * @return : The nearest-rank percentile of the preparation times in the kitchen, 0 if it is empty,
+     * in O(log n) plus merging buffered updates, as `countDishesBelowPrepTime`.
+     */
+    int prepTimePercentile(double percent) const;
 
 
     /**
      * @param : A reference to an integer representing the preparation time
      * threshold of the dishes to be removed from the kitchen.
      * @post : Removes all dishes from the kitchen whose preparation time is less than the given time.
+     * Returns in O(log n) from the preparation time index when no dish qualifies. Otherwise the
+     * removal keeps the order of the remaining dishes, so it is a compaction of the whole bag:
+     * O(n), not O(k log n) for the k dishes removed.
      * @return : The number of dishes removed from the kitchen.
      */
     int releaseDishesBelowPrepTime(int prepTimeThreshold);
@@ -103,6 +393,101 @@ public:
      */
     int releaseDishesOfCuisineType(const std::string& cuisineType);
 
+    /**
+     * @param : A reference to a string naming an ingredient.
+     * @return : The number of dishes in the kitchen that use the ingredient, from the
+     * ingredient index without looking at the dishes.
+     */
+    int tallyIngredient(const std::string& ingredient) const;
+
+    /**
+     * @param : A list of ingredients.
+     * @return : The number of dishes in the kitchen that use every one of the ingredients,
+     * computed as an intersection of the ingredients' slot bitsets.
+     */
+    int tallyDishesContainingAll(const std::vector<std::string>& ingredients) const;
+
+    /**
+     * @param : A list of ingredients.
+     * @return : The number of dishes in the kitchen that use at least one of the ingredients,
+     * computed as a union of the ingredients' slot bitsets.
+     */
+    int tallyDishesContainingAny(const std::vector<std::string>& ingredients) const;
+
+    /**
+     * @param : A reference to a string naming an ingredient, e.g. one that ran out.
+     * @post : Removes all dishes from the kitchen that use the ingredient. The remaining
+     * dishes keep their relative order.
+     * @return : The number of dishes removed from the kitchen.
+     */
+    int releaseDishesContaining(const std::string& ingredient);
+
+    /**
+     * @param : A list of ingredients, e.g. a set of allergens.
+     * @post : Removes all dishes from the kitchen that use at least one of the ingredients.
+     * The remaining dishes keep their relative order.
+     * @return : The number of dishes removed from the kitchen.
+     */
+    int releaseDishesContainingAny(const std::vector<std::string>& ingredients);
+
+    /**
+     * @param : A predicate callable as `bool(const Dish&)` selecting the dishes to be removed.
+     * @post : Removes all dishes from the kitchen for which the predicate returns true in a
+     * single read/write pass. The remaining dishes keep their relative order and are moved,
+     * not copied, into place. The preparation time sum, elaborate count and cuisine
+     * counts are updated for every dish removed.
+     * @return : The number of dishes removed from the kitchen.
+     */
+    template<class Predicate>
+    int releaseIf(Predicate pred);
+
+    /**
+     * @param : A predicate callable as `bool(const Dish&)` selecting the dishes to be removed. It
+     * must be safe to call from several threads at once and must not throw.
+     * @post : Same as `releaseIf`. For kitchens of at least `KitchenParallel::serialThreshold()`
+     * dishes the predicate is evaluated on several threads, one chunk of slots each, and the
+     * remaining dishes are compacted in parallel; below it this is `releaseIf`.
+     * @return : The number of dishes removed from the kitchen.
+     */
+    template<class Predicate>
+    int parallelReleaseIf(Predicate pred);
+
+    /**
+     * @param : How long an order may wait before it expires, in the time unit of `expireOrders`,
+     * e.g. seconds. 0 or less means dishes never expire, which is the default.
+     * @post : Every dish, including those already in the kitchen, now expires at its order time
+     * plus the new TTL. Dishes whose expiry time has passed go at the next `expireOrders`.
+     */
+    void setOrderTtl(std::int64_t ttl);
+
+    /**
+     * @return : The time to live of an order, 0 if dishes never expire.
+     */
+    std::int64_t getOrderTtl() const;
+
+    /**
+     * @return : The kitchen clock: the last time passed to `expireOrders`, 0 before the first
+     * call. New orders are stamped with it.
+     */
+    std::int64_t getCurrentTime() const;
+
+    /**
+     * @param : The slot of a dish, from 0 to getCurrentSize() - 1.
+     * @return : The time the dish was ordered, the kitchen clock when it was added.
+     */
+    std::int64_t getOrderTime(int slot) const;
+
+    /**
+     * @param : The current time, in the unit of the TTL. Times before the kitchen clock are ignored.
+     * @post : Advances the kitchen clock and removes every dish whose order time plus TTL is at
+     * most the given time, oldest expiry first. As in `serveDish`, the slot of each dish removed
+     * is filled with the last dish in the kitchen. The running totals and indexes are updated and
+     * the observers are told of each removal as a release. The dishes to remove are found in a
+     * timing wheel, see OrderExpiryWheel.hpp, so this costs O(dishes removed) rather than a scan.
+     * @return : The number of dishes removed from the kitchen.
+     */
+    int expireOrders(std::int64_t now);
+
 
     /**
      * @post : Outputs a report of the dishes currently in the kitchen in the
@@ -123,11 +508,376 @@ public:
      *          ELABORATE DISHES: 53.85%
      */
      void kitchenReport();
+
+    /**
+     * @param : A reference to the output stream the report is written to.
+     * @post : Writes the report described in `kitchenReport()` to the stream with a single
+     * write, using '\n' rather than std::endl and leaving the stream's formatting flags unchanged.
+     */
+     void kitchenReport(std::ostream& out) const;
+
+    /**
+     * @param : A reference to the string the report described in `kitchenReport()` is appended to.
+     */
+     void appendReport(std::string& buffer) const;
+
+    /**
+     * @param : A reference to the output stream the dishes are written to.
+     * @post : Writes every dish in the kitchen, in the format of `Dish::display()` and in kitchen
+     * order, to the stream with a single buffered write.
+     */
+     void dumpDishes(std::ostream& out) const;
+
+    /**
+     * @param : A reference to the string every dish in the kitchen is appended to, in the
+     * format of `Dish::display()` and in kitchen order.
+     */
+     void appendDishes(std::string& buffer) const;
+
+    /**
+     * @param : A reference to a binary output stream.
+     * @post : Writes a binary snapshot of the dishes and running totals, see KitchenSnapshot.hpp.
+     * @return : Returns true if the whole snapshot was written, false otherwise.
+     */
+    bool saveSnapshot(std::ostream& out) const;
+
+    /**
+     * @param : The path of the snapshot file to create or replace.
+     * @return : Returns true if the whole snapshot was written, false otherwise.
+     */
+    bool saveSnapshot(const std::string& path) const;
+
+    /**
+     * @param : A reference to an open snapshot view, e.g. of a file mapped with `KitchenSnapshotView::open`.
+     * @post : Replaces the contents of the kitchen with the dishes in the snapshot, in snapshot order.
+     * The running totals are taken from the header, which opening the view checked against the
+     * records, and the elaborate flags are checked against the kitchen's elaborate policy, which
+     * may differ from the policy of the kitchen that saved the snapshot. The kitchen is left
+     * unchanged if the view is not open, the dishes do not fit, their preparation times add up to
+     * more than an int, or a dish has an invalid name or equals another (see
+     * `KitchenSnapshotView::hasDistinctValidDishes`).
+     * @return : Returns true if the kitchen was restored, false otherwise.
+     */
+    bool restoreSnapshot(const KitchenSnapshotView& snapshot);
 private:
-    int totalprep_time_;
+    int total_prep_time_;
+    Price total_revenue_;
     int count_elaborate_;
+    ElaboratePolicy elaborate_policy_;
+    std::array<int, Dish::CUISINE_TYPE_COUNT> cuisine_counts_; // number of dishes per CuisineType
+    bool use_dish_index_;
+    DishIndex dish_index_;
+    KitchenColumns columns_; // hot fields of items_, slot for slot
+    KitchenObserverList observers_;
+    PrepTimeIndex prep_time_index_; // preparation times of items_, sorted
+    PrepTimeSketch prep_time_sketch_; // preparation times of items_, bucketed for stats()
+    IngredientIndex ingredient_index_; // ingredient -> slots of the dishes using it
+    OrderExpiryWheel expiry_wheel_; // order times of items_, slot for slot, and their expiry times
+    std::shared_ptr<IngredientListPool> ingredient_arena_; // ingredient lists of items_, shared with copies and views
+    std::shared_ptr<const KitchenView> last_view_; // the latest view(), whose unchanged chunks the next one shares
+    std::vector<std::uint8_t> view_dirty_chunks_; // per chunk of last_view_, nonzero if a slot in it was written since
+#ifdef KITCHEN_INSTRUMENTATION
+    mutable KitchenInstrumentation instrumentation_; // hot path counters, also updated by const operations
+#endif
+
+    /**
+     * @param : A reference to a `Dish`.
+     * @return : Returns true if the dish is elaborate under the kitchen's elaborate policy,
+     * false otherwise. Under the default policy this reads the flag cached in the dish.
+     */
+    bool isElaborate(const Dish& a_dish) const;
+
+    /**
+     * @return : A pointer to the first element of items_.
+     */
+    const Dish* itemData() const;
+
+    /**
+     * @param : A slot of items_ about to be written.
+     * @post : The chunk of the latest view holding the slot, if any, is copied again by the next `view()`.
+     */
+    void markViewChanged(int slot);
+
+    /**
+     * @param : The first slot of a run of slots about to be written.
+     * @param : The slot after the run.
+     * @post : Same as `markViewChanged(int)` for every slot of the run.
+     */
+    void markViewChanged(int begin_slot, int end_slot);
+
+    /**
+     * @param : The number of dishes that must fit in the kitchen.
+     * @post : Grows the storage geometrically if needed.
+     * @return : Returns true if that many dishes fit, false if the capacity is fixed and too small.
+     */
+    bool makeRoomFor(int count);
+
+    /**
+     * @pre : The dish has just been written to items_[item_count_].
+     * @post : The dish becomes part of the kitchen: it is indexed, counted and added to the running totals.
+     */
+    void recordAppended();
+
+    /**
+     * @param : The first slot of a run of dishes appended to items_ and columns_, ending at item_count_.
+     * @post : Adds the whole run to the running totals at once.
+     */
+    void recordAppendedRange(int first_slot);
+
+    /**
+     * @param : A mask with one byte per slot, nonzero for the slots to be removed.
+     * @param : The number of nonzero bytes in the mask.
+     * @post : Removes the marked dishes, individually if there are few of them, with one
+     * compaction pass otherwise.
+     */
+    void removeMarked(const std::vector<std::uint8_t>& remove_mask, int marked_count);
+
+    /**
+     * @param : A reference to a `Dish`.
+     * @return : The slot in items_ of a dish equal to the given `Dish`, or -1 if there is none.
+     */
+    int findDish(const Dish& a_dish) const;
+
+    /**
+     * @param : A reference to a `Dish`.
+     * @param : The instrumented operation the Dish comparisons of the search are counted for.
+     * @return : Same as `findDish(a_dish)`.
+     */
+    int findDish(const Dish& a_dish, KitchenInstrumentation::Operation operation) const;
+
+    /**
+     * @param : Why dishes are removed.
+     * @return : The instrumented operation the removal belongs to.
+     */
+    static KitchenInstrumentation::Operation removalOperation(KitchenObserver::RemovalReason reason);
+
+    /**
+     * @param : The slot in items_ of the dish to be removed.
+     * @param : Why the dish is removed, passed on to the observers.
+     * @post : Updates the running totals, then fills the slot with the last dish in the kitchen.
+     */
+    void removeAt(int slot, KitchenObserver::RemovalReason reason);
+
+    /**
+     * @param : The slot of a dish added to the kitchen, already present in columns_.
+     * @post : Adds the dish to the preparation time sum, revenue, elaborate count and cuisine counts.
+     */
+    void recordAdded(int slot);
+
+    /**
+     * @param : The slot of a dish being removed from the kitchen, still present in columns_.
+     * @post : Removes the dish from the preparation time sum, revenue, elaborate count and cuisine counts.
+     */
+    void recordRemoved(int slot);
+
+    /**
+     * @param : A mask with one byte per slot, nonzero for the slots to be removed.
+     * @param : Why the dishes are removed, passed on to the observers.
+     * @return : The number of dishes removed, see `compactIf`.
+     */
+    int releaseMarked(const std::vector<std::uint8_t>& remove_mask, KitchenObserver::RemovalReason reason);
+
+    /**
+     * @param : A mask with one byte per slot, nonzero for the slots to be removed.
+     * @param : Why the dishes are removed.
+     * @param : The number of workers, at least 2.
+     * @post : Removes the marked dishes like `compactIf`, keeping the others in order, but with the
+     * scans and moves split across workers. The indexes are rebuilt rather than updated slot by
+     * slot. Observers are not notified, so this is only used when there are none.
+     * @return : The number of dishes removed.
+     */
+    int compactMarkedParallel(const std::vector<std::uint8_t>& remove_mask, KitchenObserver::RemovalReason reason,
+                              int worker_count);
+
+    /**
+     * @param : A set with one bit per slot, set for the slots to be removed. It must not be
+     * the index's own set, which changes while the dishes are removed.
+     * @return : The number of dishes removed, see `compactIf`.
+     */
+    int releaseSlots(const IngredientIndex::SlotSet& slots);
+
+    /**
+     * @param : A predicate callable as `bool(int slot)` selecting the slots to be removed. It is
+     * called once per slot, in order, before that slot is overwritten.
+     * @param : Why the dishes are removed, passed on to the observers.
+     * @post : Removes the selected dishes in one stable read/write pass over items_ and columns_,
+     * updating the running totals and index.
+     * @return : The number of dishes removed from the kitchen.
+     */
+    template<class SlotPredicate>
+    int compactIf(SlotPredicate remove_slot, KitchenObserver::RemovalReason reason);
 };
 
+/**
+ * @param : A pair of forward iterators delimiting the dishes to be added.
+ * @post : Adds every dish in the range that is not already in the kitchen (or earlier in the
+ * range), in range order, updating the running totals once for the batch.
+ * @return : One flag per dish in the range, true if that dish was added.
+ */
+template<class ForwardIterator>
+std::vector<bool> Kitchen::newOrders(ForwardIterator first, ForwardIterator last)
+{
+    std::vector<bool> added(static_cast<std::size_t>(std::distance(first, last)), false);
+    int first_new_slot = item_count_;
+    makeRoomFor(item_count_ + static_cast<int>(added.size()));
+    columns_.reserve(item_count_ + static_cast<int>(added.size()));
+    expiry_wheel_.reserve(item_count_ + static_cast<int>(added.size()));
+
+    DishIndex scratch_index;
+    DishIndex* index = &dish_index_;
+    if (!use_dish_index_)
+    {
+        scratch_index.rebuild(itemData(), item_count_);
+        index = &scratch_index;
+    }
+
+    for (std::size_t i = 0; first != last; ++first, ++i)
+    {
+        const Dish& a_dish = *first;
+        if (index->findSlot(a_dish, itemData()) > -1 || !makeRoomFor(item_count_ + 1))
+            continue;
+
+        markViewChanged(item_count_);
+        items_[item_count_] = *first;
+        items_[item_count_].internIngredientsIn(*ingredient_arena_);
+        index->insert(items_[item_count_], item_count_);
+        ingredient_index_.insert(items_[item_count_], item_count_);
+        columns_.pushBack(items_[item_count_], isElaborate(items_[item_count_]));
+        if (!observers_.empty())
+            observers_.dishAdded(items_[item_count_], item_count_);
+        item_count_++;
+        added[i] = true;
+    }
+
+    recordAppendedRange(first_new_slot);
+    return added;
+}
+
+/**
+ * @param : A pair of forward iterators delimiting the dishes to be served.
+ * @post : Removes one dish equal to each dish in the range, in a single pass over the kitchen.
+ * @return : One flag per dish in the range, true if an equal dish was found and removed.
+ */
+template<class ForwardIterator>
+std::vector<bool> Kitchen::serveDishes(ForwardIterator first, ForwardIterator last)
+{
+    std::vector<bool> served(static_cast<std::size_t>(std::distance(first, last)), false);
+
+    DishIndex scratch_index;
+    const DishIndex* index = &dish_index_;
+    if (!use_dish_index_)
+    {
+        scratch_index.rebuild(itemData(), item_count_);
+        index = &scratch_index;
+    }
+
+    std::vector<std::uint8_t> remove_mask(item_count_, 0);
+    int marked_count = 0;
+    for (std::size_t i = 0; first != last; ++first, ++i)
+    {
+        int slot = index->findSlot(*first, itemData());
+        if (slot < 0 || remove_mask[slot])
+            continue;
+
+        remove_mask[slot] = 1;
+        marked_count++;
+        served[i] = true;
+    }
+
+    removeMarked(remove_mask, marked_count);
+    return served;
+}
+
+/**
+ * @param : A predicate callable as `bool(const Dish&)` selecting the dishes to be removed.
+ * @post : Removes all dishes from the kitchen for which the predicate returns true in a
+ * single read/write pass. The remaining dishes keep their relative order and are moved,
+ * not copied, into place. The preparation time sum, elaborate count and cuisine
+ * counts are updated for every dish removed.
+ * @return : The number of dishes removed from the kitchen.
+ */
+template<class Predicate>
+int Kitchen::releaseIf(Predicate pred)
+{
+    KITCHEN_INSTRUMENT_CALL(instrumentation_, KitchenInstrumentation::RELEASE);
+    return compactIf([this, &pred](int slot) {
+        return pred(static_cast<const Dish&>(items_[slot]));
+    }, KitchenObserver::RELEASED);
+}
+
+/**
+ * @param : A predicate callable as `bool(const Dish&)` selecting the dishes to be removed. It
+ * must be safe to call from several threads at once and must not throw.
+ * @post : Same as `releaseIf`. For kitchens of at least `KitchenParallel::serialThreshold()`
+ * dishes the predicate is evaluated on several threads, one chunk of slots each, and the
+ * remaining dishes are compacted in parallel; below it this is `releaseIf`.
+ * @return : The number of dishes removed from the kitchen.
+ */
+template<class Predicate>
+int Kitchen::parallelReleaseIf(Predicate pred)
+{
+    int worker_count = KitchenParallel::workerCount(item_count_);
+    if (worker_count < 2)
+        return releaseIf(pred);
+
+    KITCHEN_INSTRUMENT_CALL(instrumentation_, KitchenInstrumentation::RELEASE);
+    std::vector<std::uint8_t> remove_mask(item_count_);
+    const Dish* items = itemData();
+    KitchenParallel::forEachChunk(item_count_, worker_count, [&remove_mask, &pred, items](int, int begin, int end) {
+        for (int slot = begin; slot < end; ++slot)
+            remove_mask[slot] = pred(items[slot]) ? 1 : 0;
+    });
+    return releaseMarked(remove_mask, KitchenObserver::RELEASED);
+}
+
+/**
+ * @param : A predicate callable as `bool(int slot)` selecting the slots to be removed. It is
+ * called once per slot, in order, before that slot is overwritten.
+ * @param : Why the dishes are removed, passed on to the observers.
+ * @post : Removes the selected dishes in one stable read/write pass over items_ and columns_,
+ * updating the running totals and index.
+ * @return : The number of dishes removed from the kitchen.
+ */
+template<class SlotPredicate>
+int Kitchen::compactIf(SlotPredicate remove_slot, KitchenObserver::RemovalReason reason)
+{
+    int write_index = 0;
+    for (int read_index = 0; read_index < item_count_; ++read_index)
+    {
+        if (remove_slot(read_index))
+        {
+            recordRemoved(read_index);
+            ingredient_index_.erase(items_[read_index], read_index);
+            expiry_wheel_.erase(read_index);
+            if (!observers_.empty())
+                observers_.dishRemoved(items_[read_index], read_index, reason);
+        }
+        else
+        {
+            if (write_index != read_index)
+            {
+                if (!observers_.empty())
+                    observers_.dishMoved(items_[read_index], read_index, write_index);
+                ingredient_index_.moveSlot(items_[read_index], read_index, write_index);
+                markViewChanged(write_index);
+                items_[write_index] = std::move(items_[read_index]);
+                columns_.moveSlot(read_index, write_index);
+                expiry_wheel_.moveSlot(read_index, write_index);
+                KITCHEN_INSTRUMENT_MOVES(instrumentation_, removalOperation(reason), 1);
+            }
+            write_index++;
+        }
+    }
+
+    int removed_count = item_count_ - write_index;
+    item_count_ = write_index;
+    columns_.truncate(write_index);
+    expiry_wheel_.truncate(write_index);
+    if (use_dish_index_ && removed_count > 0)
+        dish_index_.rebuild(itemData(), item_count_);
+    return removed_count;
+}
+
 
 #endif //DISH_KITCHEN_HPP
 
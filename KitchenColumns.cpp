@@ -0,0 +1,227 @@
+/**
+ * @file KitchenColumns.cpp
+ * @brief This file contains the implementation of the KitchenColumns class, a structure-of-arrays mirror of a Kitchen.
+ *
+ * The scans are written as plain counted loops over single arrays, without early exits or branches in the body,
+ * so that they auto-vectorize. The preparation time filters and the cuisine histogram use the runtime-dispatched
+ * SIMD kernels in KitchenKernels.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenColumns.hpp"
+#include "KitchenKernels.hpp"
+#include <algorithm>
+
+void KitchenColumns::Aggregates::add(const Aggregates& other) {
+    dish_count += other.dish_count;
+    prep_time_sum += other.prep_time_sum;
+    price_cents_sum += other.price_cents_sum;
+    elaborate_count += other.elaborate_count;
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+        cuisine_counts[c] += other.cuisine_counts[c];
+    }
+}
+
+int KitchenColumns::size() const {
+    return static_cast<int>(prep_times_.size());
+}
+
+void KitchenColumns::reserve(int capacity) {
+    if (capacity <= static_cast<int>(prep_times_.capacity())) {
+        return;
+    }
+    // Grow at least geometrically, so reserving a little more for each of many small batches stays amortized O(1)
+    std::size_t new_capacity = std::max(static_cast<std::size_t>(capacity), 2 * prep_times_.capacity());
+    prep_times_.reserve(new_capacity);
+    prices_.reserve(new_capacity);
+    cuisine_types_.reserve(new_capacity);
+    ingredient_counts_.reserve(new_capacity);
+    elaborate_flags_.reserve(new_capacity);
+}
+
+void KitchenColumns::clear() {
+    prep_times_.clear();
+    prices_.clear();
+    cuisine_types_.clear();
+    ingredient_counts_.clear();
+    elaborate_flags_.clear();
+}
+
+void KitchenColumns::pushBack(const Dish& a_dish, bool elaborate) {
+    prep_times_.push_back(a_dish.getPrepTime());
+    prices_.push_back(a_dish.getPriceValue().cents());
+    cuisine_types_.push_back(static_cast<std::uint8_t>(a_dish.getCuisineTypeEnum()));
+    ingredient_counts_.push_back(a_dish.getIngredientCount());
+    elaborate_flags_.push_back(elaborate ? 1 : 0);
+}
+
+void KitchenColumns::moveSlot(int from_slot, int to_slot) {
+    prep_times_[to_slot] = prep_times_[from_slot];
+    prices_[to_slot] = prices_[from_slot];
+    cuisine_types_[to_slot] = cuisine_types_[from_slot];
+    ingredient_counts_[to_slot] = ingredient_counts_[from_slot];
+    elaborate_flags_[to_slot] = elaborate_flags_[from_slot];
+}
+
+void KitchenColumns::setSlot(int slot, const Dish& a_dish, bool elaborate) {
+    prep_times_[slot] = a_dish.getPrepTime();
+    prices_[slot] = a_dish.getPriceValue().cents();
+    cuisine_types_[slot] = static_cast<std::uint8_t>(a_dish.getCuisineTypeEnum());
+    ingredient_counts_[slot] = a_dish.getIngredientCount();
+    elaborate_flags_[slot] = elaborate ? 1 : 0;
+}
+
+void KitchenColumns::truncate(int new_size) {
+    prep_times_.resize(new_size);
+    prices_.resize(new_size);
+    cuisine_types_.resize(new_size);
+    ingredient_counts_.resize(new_size);
+    elaborate_flags_.resize(new_size);
+}
+
+int KitchenColumns::getPrepTime(int slot) const {
+    return prep_times_[slot];
+}
+
+Price::Cents KitchenColumns::getPriceCents(int slot) const {
+    return prices_[slot];
+}
+
+Dish::CuisineType KitchenColumns::getCuisineType(int slot) const {
+    return static_cast<Dish::CuisineType>(cuisine_types_[slot]);
+}
+
+int KitchenColumns::getIngredientCount(int slot) const {
+    return ingredient_counts_[slot];
+}
+
+bool KitchenColumns::isElaborate(int slot) const {
+    return elaborate_flags_[slot] != 0;
+}
+
+const int* KitchenColumns::prepTimes() const {
+    return prep_times_.data();
+}
+
+const Price::Cents* KitchenColumns::priceCents() const {
+    return prices_.data();
+}
+
+const std::uint8_t* KitchenColumns::cuisineTypes() const {
+    return cuisine_types_.data();
+}
+
+const std::uint8_t* KitchenColumns::elaborateFlags() const {
+    return elaborate_flags_.data();
+}
+
+long long KitchenColumns::sumPrepTimes() const {
+    const int* prep_times = prep_times_.data();
+    int count = size();
+    long long sum = 0;
+    for (int i = 0; i < count; ++i) {
+        sum += prep_times[i];
+    }
+    return sum;
+}
+
+Price::Cents KitchenColumns::sumPriceCents() const {
+    const Price::Cents* prices = prices_.data();
+    int count = size();
+    Price::Cents sum = 0;
+    for (int i = 0; i < count; ++i) {
+        sum += prices[i];
+    }
+    return sum;
+}
+
+int KitchenColumns::countElaborate() const {
+    const std::uint8_t* flags = elaborate_flags_.data();
+    int count = size();
+    int elaborate = 0;
+    for (int i = 0; i < count; ++i) {
+        elaborate += flags[i];
+    }
+    return elaborate;
+}
+
+KitchenColumns::Aggregates KitchenColumns::aggregate(int begin, int end) const {
+    Aggregates totals;
+    totals.dish_count = end - begin;
+    for (int i = begin; i < end; ++i) {
+        totals.prep_time_sum += prep_times_[i];
+        totals.price_cents_sum += prices_[i];
+        totals.elaborate_count += elaborate_flags_[i];
+    }
+    KitchenKernels::byteHistogram(cuisine_types_.data() + begin, end - begin, totals.cuisine_counts.data(),
+                                  Dish::CUISINE_TYPE_COUNT);
+    return totals;
+}
+
+KitchenColumns::Aggregates KitchenColumns::aggregateMarked(int begin, int end, const std::uint8_t* mask) const {
+    Aggregates totals;
+    for (int i = begin; i < end; ++i) {
+        if (mask[i]) {
+            totals.dish_count++;
+            totals.prep_time_sum += prep_times_[i];
+            totals.price_cents_sum += prices_[i];
+            totals.elaborate_count += elaborate_flags_[i];
+            totals.cuisine_counts[cuisine_types_[i]]++;
+        }
+    }
+    return totals;
+}
+
+int KitchenColumns::reclassifyElaborate(const ElaboratePolicy& policy) {
+    const int* prep_times = prep_times_.data();
+    const int* ingredient_counts = ingredient_counts_.data();
+    std::uint8_t* flags = elaborate_flags_.data();
+    const int min_prep_time = policy.minPrepTime();
+    const int min_ingredients = policy.minIngredients();
+    int count = size();
+    int delta = 0;
+    for (int i = 0; i < count; ++i) {
+        std::uint8_t elaborate = (ingredient_counts[i] >= min_ingredients) & (prep_times[i] >= min_prep_time);
+        delta += int(elaborate) - int(flags[i]);
+        flags[i] = elaborate;
+    }
+    return delta;
+}
+
+int KitchenColumns::countCuisineType(Dish::CuisineType cuisine_type) const {
+    const std::uint8_t* cuisine_types = cuisine_types_.data();
+    const std::uint8_t target = static_cast<std::uint8_t>(cuisine_type);
+    int count = size();
+    int frequency = 0;
+    for (int i = 0; i < count; ++i) {
+        frequency += (cuisine_types[i] == target);
+    }
+    return frequency;
+}
+
+void KitchenColumns::cuisineHistogram(std::array<int, Dish::CUISINE_TYPE_COUNT>& counts) const {
+    KitchenKernels::byteHistogram(cuisine_types_.data(), size(), counts.data(), Dish::CUISINE_TYPE_COUNT);
+}
+
+int KitchenColumns::countPrepTimeBelow(int threshold) const {
+    return KitchenKernels::countPrepTimeBelow(prep_times_.data(), size(), threshold);
+}
+
+int KitchenColumns::markPrepTimeBelow(int threshold, std::uint8_t* mask) const {
+    return KitchenKernels::markPrepTimeBelow(prep_times_.data(), size(), threshold, mask);
+}
+
+int KitchenColumns::markCuisineType(Dish::CuisineType cuisine_type, std::uint8_t* mask) const {
+    const std::uint8_t* cuisine_types = cuisine_types_.data();
+    const std::uint8_t target = static_cast<std::uint8_t>(cuisine_type);
+    int count = size();
+    int marked = 0;
+    for (int i = 0; i < count; ++i) {
+        std::uint8_t match = (cuisine_types[i] == target);
+        mask[i] = match;
+        marked += match;
+    }
+    return marked;
+}
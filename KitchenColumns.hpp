@@ -0,0 +1,172 @@
+/**
+ * @file KitchenColumns.hpp
+ * @brief This file contains the declaration of the KitchenColumns class, a structure-of-arrays mirror of a Kitchen.
+ *
+ * KitchenColumns keeps the fields the Kitchen aggregates over (preparation time, price, cuisine type, ingredient count
+ * and the elaborate flag) in contiguous arrays, one entry per slot of the kitchen's items_. Scans over these arrays read only the bytes
+ * they need and are simple enough for the compiler to auto-vectorize, instead of walking full Dish objects with their
+ * names and ingredient lists.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef KITCHEN_COLUMNS_HPP
+#define KITCHEN_COLUMNS_HPP
+
+#include "Dish.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+class KitchenColumns {
+public:
+    /**
+     * Totals over a set of slots.
+     */
+    struct Aggregates {
+        int dish_count = 0;
+        long long prep_time_sum = 0;
+        Price::Cents price_cents_sum = 0;
+        int elaborate_count = 0;
+        std::array<int, Dish::CUISINE_TYPE_COUNT> cuisine_counts{};
+
+        /**
+         * @param other A reference to the totals over other slots, added to these.
+         */
+        void add(const Aggregates& other);
+    };
+
+    /**
+     * @return The number of slots in the columns.
+     */
+    int size() const;
+
+    /**
+     * @param capacity The number of slots to reserve memory for. If the columns must grow, they grow to at least
+     * twice their current capacity.
+     */
+    void reserve(int capacity);
+
+    /**
+     * @post Removes all slots.
+     */
+    void clear();
+
+    /**
+     * @param a_dish A reference to the dish stored in the new slot.
+     * @param elaborate Whether the dish counts as elaborate.
+     * @post Appends a slot holding the dish's fields.
+     */
+    void pushBack(const Dish& a_dish, bool elaborate);
+
+    /**
+     * @param from_slot The slot whose fields are copied.
+     * @param to_slot The slot being overwritten.
+     */
+    void moveSlot(int from_slot, int to_slot);
+
+    /**
+     * @param slot A slot from 0 to size() - 1.
+     * @param a_dish A reference to the dish now stored in the slot.
+     * @param elaborate Whether the dish counts as elaborate.
+     * @post Overwrites the fields of the slot. Different slots may be set from different threads at once.
+     */
+    void setSlot(int slot, const Dish& a_dish, bool elaborate);
+
+    /**
+     * @param new_size The number of leading slots to keep, at most size().
+     */
+    void truncate(int new_size);
+
+    // Per-slot accessors
+    int getPrepTime(int slot) const;
+    Price::Cents getPriceCents(int slot) const;
+    Dish::CuisineType getCuisineType(int slot) const;
+    int getIngredientCount(int slot) const;
+    bool isElaborate(int slot) const;
+
+    // Raw column access, size() entries each
+    const int* prepTimes() const;
+    const Price::Cents* priceCents() const;
+    const std::uint8_t* cuisineTypes() const;
+    const std::uint8_t* elaborateFlags() const;
+
+    /**
+     * @return The sum of the preparation times of all slots.
+     */
+    long long sumPrepTimes() const;
+
+    /**
+     * @return The sum of the prices of all slots, in cents.
+     */
+    Price::Cents sumPriceCents() const;
+
+    /**
+     * @return The number of slots flagged as elaborate.
+     */
+    int countElaborate() const;
+
+    /**
+     * @param begin The first slot.
+     * @param end The slot after the last one, at most size().
+     * @return The totals over the slots [begin, end).
+     */
+    Aggregates aggregate(int begin, int end) const;
+
+    /**
+     * @param begin The first slot.
+     * @param end The slot after the last one, at most size().
+     * @param mask A pointer to size() bytes; only the slots whose byte is nonzero are counted.
+     * @return The totals over the marked slots in [begin, end).
+     */
+    Aggregates aggregateMarked(int begin, int end, const std::uint8_t* mask) const;
+
+    /**
+     * @param policy A reference to the rule deciding whether a dish is elaborate.
+     * @post Sets the elaborate flag of every slot to its classification under the policy, from the preparation
+     * time and ingredient count columns.
+     * @return The number of slots that became elaborate minus the number that stopped being elaborate.
+     */
+    int reclassifyElaborate(const ElaboratePolicy& policy);
+
+    /**
+     * @param cuisine_type A CuisineType enum value.
+     * @return The number of slots of the given cuisine type.
+     */
+    int countCuisineType(Dish::CuisineType cuisine_type) const;
+
+    /**
+     * @param counts A reference to an array receiving the number of slots of each cuisine type.
+     */
+    void cuisineHistogram(std::array<int, Dish::CUISINE_TYPE_COUNT>& counts) const;
+
+    /**
+     * @param threshold A preparation time in minutes.
+     * @return The number of slots whose preparation time is less than the threshold.
+     */
+    int countPrepTimeBelow(int threshold) const;
+
+    /**
+     * @param threshold A preparation time in minutes.
+     * @param mask A pointer to size() bytes. Each is set to 1 if the slot's preparation time is less than the threshold, 0 otherwise.
+     * @return The number of slots marked.
+     */
+    int markPrepTimeBelow(int threshold, std::uint8_t* mask) const;
+
+    /**
+     * @param cuisine_type A CuisineType enum value.
+     * @param mask A pointer to size() bytes. Each is set to 1 if the slot has the given cuisine type, 0 otherwise.
+     * @return The number of slots marked.
+     */
+    int markCuisineType(Dish::CuisineType cuisine_type, std::uint8_t* mask) const;
+
+private:
+    std::vector<int> prep_times_;
+    std::vector<Price::Cents> prices_;
+    std::vector<std::uint8_t> cuisine_types_;    // Dish::CuisineType values
+    std::vector<int> ingredient_counts_;
+    std::vector<std::uint8_t> elaborate_flags_;  // 1 if elaborate, 0 otherwise
+};
+
+#endif // KITCHEN_COLUMNS_HPP
@@ -0,0 +1,97 @@
+/**
+ * @file KitchenEventLog.cpp
+ * @brief This file contains the implementation of the KitchenEventLog class, a ring buffer of compact change events
+ * recorded from a Kitchen.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenEventLog.hpp"
+#include <algorithm>
+
+KitchenEventLog::KitchenEventLog(int capacity) : next_sequence_(0), oldest_sequence_(0) {
+    std::size_t rounded = 2;
+    while (rounded < static_cast<std::size_t>(capacity)) {
+        rounded <<= 1;
+    }
+    ring_.resize(rounded);
+    mask_ = rounded - 1;
+}
+
+int KitchenEventLog::capacity() const {
+    return static_cast<int>(ring_.size());
+}
+
+std::uint64_t KitchenEventLog::nextSequence() const {
+    return next_sequence_;
+}
+
+std::uint64_t KitchenEventLog::oldestSequence() const {
+    return oldest_sequence_;
+}
+
+bool KitchenEventLog::missedEvents(std::uint64_t cursor) const {
+    return cursor < oldest_sequence_;
+}
+
+std::size_t KitchenEventLog::read(std::uint64_t& cursor, Event* events, std::size_t max_events) const {
+    if (cursor < oldest_sequence_) {
+        cursor = oldest_sequence_;
+    }
+    std::size_t available = (cursor < next_sequence_) ? static_cast<std::size_t>(next_sequence_ - cursor) : 0;
+    std::size_t count = std::min(available, max_events);
+    for (std::size_t i = 0; i < count; ++i) {
+        events[i] = ring_[(cursor + i) & mask_];
+    }
+    cursor += count;
+    return count;
+}
+
+const KitchenEventLog::Event& KitchenEventLog::at(std::uint64_t sequence) const {
+    return ring_[sequence & mask_];
+}
+
+void KitchenEventLog::clear() {
+    oldest_sequence_ = next_sequence_;
+}
+
+void KitchenEventLog::dishAdded(const Dish& a_dish, int slot) {
+    record(DISH_ADDED, &a_dish, slot, -1);
+}
+
+void KitchenEventLog::dishRemoved(const Dish& a_dish, int slot, RemovalReason reason) {
+    record(reason == KitchenObserver::SERVED ? DISH_SERVED : DISH_RELEASED, &a_dish, slot, -1);
+}
+
+void KitchenEventLog::dishMoved(const Dish& a_dish, int from_slot, int to_slot) {
+    record(DISH_MOVED, &a_dish, from_slot, to_slot);
+}
+
+void KitchenEventLog::kitchenCleared() {
+    record(KITCHEN_CLEARED, nullptr, -1, -1);
+}
+
+void KitchenEventLog::record(EventType type, const Dish* a_dish, int slot, int to_slot) {
+    Event& event = ring_[next_sequence_ & mask_];
+    event.sequence = next_sequence_;
+    event.type = type;
+    event.slot = slot;
+    event.to_slot = to_slot;
+    if (a_dish != nullptr) {
+        event.name_id = a_dish->getNameId();
+        event.prep_time = a_dish->getPrepTime();
+        event.price_cents = a_dish->getPriceValue().cents();
+        event.cuisine_type = static_cast<std::uint8_t>(a_dish->getCuisineTypeEnum());
+    } else {
+        event.name_id = 0;
+        event.prep_time = 0;
+        event.price_cents = 0;
+        event.cuisine_type = static_cast<std::uint8_t>(Dish::OTHER);
+    }
+
+    next_sequence_++;
+    if (next_sequence_ - oldest_sequence_ > ring_.size()) {
+        oldest_sequence_ = next_sequence_ - ring_.size();
+    }
+}
@@ -0,0 +1,119 @@
+/**
+ * @file KitchenEventLog.hpp
+ * @brief This file contains the declaration of the KitchenEventLog class, a ring buffer of compact change events
+ * recorded from a Kitchen.
+ *
+ * Registered with `Kitchen::addObserver`, the log turns every addition, serve, release, slot move and clear into a
+ * fixed-size Event holding the dish's slot and key fields (name Id, preparation time, price and cuisine type), never
+ * a copy of the Dish. Events are numbered in order. Readers such as caches and dashboards keep the sequence number
+ * of the next event they want and call `read` to catch up, updating their view incrementally instead of copying
+ * and diffing the kitchen. The ring has a fixed capacity and recording never allocates; when it wraps, the oldest
+ * events are overwritten, and a reader that fell that far behind can tell with `missedEvents` and rescan once.
+ *
+ * Like the kitchen it observes, the log is not thread-safe: record and read from the thread that owns the kitchen.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef KITCHEN_EVENT_LOG_HPP
+#define KITCHEN_EVENT_LOG_HPP
+
+#include "Dish.hpp"
+#include "KitchenObserver.hpp"
+#include "Price.hpp"
+#include "StringPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class KitchenEventLog : public KitchenObserver {
+public:
+    enum EventType : std::uint8_t { DISH_ADDED, DISH_SERVED, DISH_RELEASED, DISH_MOVED, KITCHEN_CLEARED };
+
+    /**
+     * One change to the kitchen. It holds no pointer into the kitchen, so it stays valid after the dish is gone.
+     */
+    struct Event {
+        std::uint64_t sequence;     // position in the stream, counting from 0
+        Price::Cents price_cents;
+        StringPool::Id name_id;     // Id of the dish name in StringPool::global()
+        std::int32_t slot;          // slot of items_ the dish was added to, removed from or moved from; -1 for KITCHEN_CLEARED
+        std::int32_t to_slot;       // slot the dish was moved to for DISH_MOVED, -1 otherwise
+        std::int32_t prep_time;
+        EventType type;
+        std::uint8_t cuisine_type;  // a Dish::CuisineType value
+
+        Dish::CuisineType cuisineType() const { return static_cast<Dish::CuisineType>(cuisine_type); }
+    };
+
+    /**
+     * Parameterized constructor.
+     * @param capacity The minimum number of events kept. It is rounded up to a power of two.
+     */
+    explicit KitchenEventLog(int capacity);
+
+    /**
+     * @return The number of events the ring holds before it overwrites the oldest.
+     */
+    int capacity() const;
+
+    /**
+     * @return The sequence number the next event will get, i.e. the number of events recorded so far.
+     */
+    std::uint64_t nextSequence() const;
+
+    /**
+     * @return The sequence number of the oldest event still in the ring, nextSequence() if there is none.
+     */
+    std::uint64_t oldestSequence() const;
+
+    /**
+     * @param cursor The sequence number of the next event a reader wants.
+     * @return True if some of the events from `cursor` on have been overwritten, so a reader at `cursor` has to
+     * resynchronize from the kitchen itself before reading on.
+     */
+    bool missedEvents(std::uint64_t cursor) const;
+
+    /**
+     * Copies the events from `cursor` on, oldest first. A cursor behind oldestSequence() skips to it.
+     * @param cursor A reference to the sequence number of the next event wanted, advanced past the copied events.
+     * @param events A pointer to room for `max_events` events.
+     * @param max_events The most events to copy.
+     * @return The number of events copied.
+     */
+    std::size_t read(std::uint64_t& cursor, Event* events, std::size_t max_events) const;
+
+    /**
+     * @param sequence A sequence number from oldestSequence() to nextSequence() - 1.
+     * @return A reference to that event, valid until it is overwritten.
+     */
+    const Event& at(std::uint64_t sequence) const;
+
+    /**
+     * @post Forgets every event. Sequence numbers keep counting, so readers' cursors stay meaningful.
+     */
+    void clear();
+
+    // KitchenObserver
+    void dishAdded(const Dish& a_dish, int slot) override;
+    void dishRemoved(const Dish& a_dish, int slot, RemovalReason reason) override;
+    void dishMoved(const Dish& a_dish, int from_slot, int to_slot) override;
+    void kitchenCleared() override;
+
+private:
+    std::vector<Event> ring_;
+    std::uint64_t mask_;
+    std::uint64_t next_sequence_;
+    std::uint64_t oldest_sequence_;
+
+    /**
+     * @param type The kind of change.
+     * @param a_dish A pointer to the dish the change is about, nullptr for KITCHEN_CLEARED.
+     * @param slot See Event::slot.
+     * @param to_slot See Event::to_slot.
+     */
+    void record(EventType type, const Dish* a_dish, int slot, int to_slot);
+};
+
+#endif // KITCHEN_EVENT_LOG_HPP
@@ -0,0 +1,111 @@
+/**
+ * @file KitchenInstrumentation.cpp
+ * @brief This file contains the implementation of the KitchenInstrumentation class, per-operation counters and
+ * latency histograms for the hot paths of a Kitchen.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenInstrumentation.hpp"
+#include "TextFormat.hpp"
+#include <cmath>
+
+namespace {
+
+// Index of the latency bucket for a duration: the position of its highest set bit
+int latencyBucket(std::uint64_t nanoseconds) {
+    int bucket = 0;
+    while (nanoseconds > 1 && bucket < KitchenInstrumentation::LATENCY_BUCKET_COUNT - 1) {
+        nanoseconds >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+} // namespace
+
+std::uint64_t KitchenInstrumentation::OperationStats::latencyPercentile(double percent) const {
+    if (calls == 0) {
+        return 0;
+    }
+    double clamped = percent < 0.0 ? 0.0 : (percent > 100.0 ? 100.0 : percent);
+    std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(calls)));
+    if (rank == 0) {
+        rank = 1;
+    }
+    std::uint64_t seen = 0;
+    for (int b = 0; b < LATENCY_BUCKET_COUNT; ++b) {
+        seen += latency_buckets[b];
+        if (seen >= rank) {
+            return std::uint64_t(2) << b;
+        }
+    }
+    return std::uint64_t(2) << (LATENCY_BUCKET_COUNT - 1);
+}
+
+void KitchenInstrumentation::Snapshot::appendTo(std::string& buffer) const {
+    for (int op = 0; op < OPERATION_COUNT; ++op) {
+        const OperationStats& stats = operations[op];
+        buffer += operationName(static_cast<Operation>(op));
+        buffer += ": calls=";
+        appendInteger(buffer, static_cast<long long>(stats.calls));
+        buffer += " comparisons=";
+        appendInteger(buffer, static_cast<long long>(stats.comparisons));
+        buffer += " moves=";
+        appendInteger(buffer, static_cast<long long>(stats.moves));
+        buffer += " mean_ns=";
+        appendInteger(buffer, static_cast<long long>(stats.calls > 0 ? stats.total_nanoseconds / stats.calls : 0));
+        buffer += " p50_ns<=";
+        appendInteger(buffer, static_cast<long long>(stats.latencyPercentile(50)));
+        buffer += " p99_ns<=";
+        appendInteger(buffer, static_cast<long long>(stats.latencyPercentile(99)));
+        buffer += '\n';
+    }
+}
+
+std::string_view KitchenInstrumentation::operationName(Operation operation) {
+    switch (operation) {
+        case NEW_ORDER: return "newOrder";
+        case SERVE_DISH: return "serveDish";
+        case TALLY_CUISINE_TYPES: return "tallyCuisineTypes";
+        case RELEASE: return "release";
+        case KITCHEN_REPORT: return "kitchenReport";
+    }
+    return "unknown";
+}
+
+KitchenInstrumentation::Snapshot KitchenInstrumentation::snapshot() const {
+    Snapshot result;
+    for (int op = 0; op < OPERATION_COUNT; ++op) {
+        const Counters& counters = counters_[op];
+        OperationStats& stats = result.operations[op];
+        stats.calls = counters.calls.load(std::memory_order_relaxed);
+        stats.comparisons = counters.comparisons.load(std::memory_order_relaxed);
+        stats.moves = counters.moves.load(std::memory_order_relaxed);
+        stats.total_nanoseconds = counters.total_nanoseconds.load(std::memory_order_relaxed);
+        for (int b = 0; b < LATENCY_BUCKET_COUNT; ++b) {
+            stats.latency_buckets[b] = counters.latency_buckets[b].load(std::memory_order_relaxed);
+        }
+    }
+    return result;
+}
+
+void KitchenInstrumentation::reset() {
+    for (Counters& counters : counters_) {
+        counters.calls.store(0, std::memory_order_relaxed);
+        counters.comparisons.store(0, std::memory_order_relaxed);
+        counters.moves.store(0, std::memory_order_relaxed);
+        counters.total_nanoseconds.store(0, std::memory_order_relaxed);
+        for (std::atomic<std::uint64_t>& bucket : counters.latency_buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void KitchenInstrumentation::recordCall(Operation operation, std::uint64_t nanoseconds) {
+    Counters& counters = counters_[operation];
+    counters.calls.fetch_add(1, std::memory_order_relaxed);
+    counters.total_nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    counters.latency_buckets[latencyBucket(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,150 @@
+/**
+ * @file KitchenInstrumentation.hpp
+ * @brief This file contains the declaration of the KitchenInstrumentation class, per-operation counters and latency
+ * histograms for the hot paths of a Kitchen.
+ *
+ * Building with KITCHEN_INSTRUMENTATION defined gives every Kitchen a KitchenInstrumentation that records, for each
+ * instrumented operation, the number of calls, the Dish comparisons made finding dishes, the Dish objects moved or
+ * copied into items_, and a histogram of call latencies in power-of-two nanosecond buckets. Without the define the
+ * KITCHEN_INSTRUMENT_* macros expand to nothing and the Kitchen holds no instrumentation at all; its snapshot is
+ * then all zeros.
+ *
+ * Counters are relaxed atomics, so the const Kitchen operations that may run on several threads at once, such as
+ * tallyCuisineTypes or countDishesBelowPrepTime while no thread modifies the kitchen, can be timed concurrently.
+ * Not every const operation qualifies: each documents whether it does.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef KITCHEN_INSTRUMENTATION_HPP
+#define KITCHEN_INSTRUMENTATION_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+class KitchenInstrumentation {
+public:
+    // The instrumented operations. RELEASE covers every release function.
+    enum Operation { NEW_ORDER, SERVE_DISH, TALLY_CUISINE_TYPES, RELEASE, KITCHEN_REPORT };
+
+    static const int OPERATION_COUNT = KITCHEN_REPORT + 1;
+
+    // Bucket b of a latency histogram counts calls that took [2^b, 2^(b+1)) nanoseconds (bucket 0 also counts 0 ns);
+    // the last bucket counts everything slower.
+    static const int LATENCY_BUCKET_COUNT = 32;
+
+    /**
+     * The counters of one operation at the time of a snapshot.
+     */
+    struct OperationStats {
+        std::uint64_t calls = 0;
+        std::uint64_t comparisons = 0;        // Dish == comparisons made finding dishes
+        std::uint64_t moves = 0;              // Dish objects moved or copied into items_
+        std::uint64_t total_nanoseconds = 0;
+        std::array<std::uint64_t, LATENCY_BUCKET_COUNT> latency_buckets{};
+
+        /**
+         * @param percent A percentage from 0 to 100, e.g. 99 for p99.
+         * @return An upper bound on the latency of that percentile of calls, in nanoseconds: the end of the bucket
+         * holding it. 0 if there were no calls.
+         */
+        std::uint64_t latencyPercentile(double percent) const;
+    };
+
+    /**
+     * The counters of every operation, indexed by Operation.
+     */
+    struct Snapshot {
+        std::array<OperationStats, OPERATION_COUNT> operations;
+
+        /**
+         * @param buffer A reference to the string a table of the counters is appended to, one line per operation.
+         */
+        void appendTo(std::string& buffer) const;
+    };
+
+    /**
+     * @param operation An Operation enum value.
+     * @return The name of the operation, e.g. "newOrder".
+     */
+    static std::string_view operationName(Operation operation);
+
+    KitchenInstrumentation() = default;
+
+    // Copying a kitchen starts the copy's counters at zero
+    KitchenInstrumentation(const KitchenInstrumentation&) {}
+    KitchenInstrumentation& operator=(const KitchenInstrumentation&) { return *this; }
+
+    /**
+     * @return The current counters of every operation.
+     */
+    Snapshot snapshot() const;
+
+    /**
+     * @post Sets every counter to zero.
+     */
+    void reset();
+
+    /**
+     * @param operation The operation that finished.
+     * @param nanoseconds How long it took.
+     */
+    void recordCall(Operation operation, std::uint64_t nanoseconds);
+
+    void addComparisons(Operation operation, std::uint64_t count) {
+        counters_[operation].comparisons.fetch_add(count, std::memory_order_relaxed);
+    }
+    void addMoves(Operation operation, std::uint64_t count) {
+        counters_[operation].moves.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    /**
+     * Records one call of an operation, timed from construction to destruction.
+     */
+    class ScopedTimer {
+    public:
+        ScopedTimer(KitchenInstrumentation& instrumentation, Operation operation)
+            : instrumentation_(instrumentation), operation_(operation), start_(std::chrono::steady_clock::now()) {}
+        ~ScopedTimer() {
+            std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start_;
+            instrumentation_.recordCall(operation_,
+                static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        KitchenInstrumentation& instrumentation_;
+        Operation operation_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+private:
+    struct Counters {
+        std::atomic<std::uint64_t> calls{0};
+        std::atomic<std::uint64_t> comparisons{0};
+        std::atomic<std::uint64_t> moves{0};
+        std::atomic<std::uint64_t> total_nanoseconds{0};
+        std::array<std::atomic<std::uint64_t>, LATENCY_BUCKET_COUNT> latency_buckets{};
+    };
+
+    std::array<Counters, OPERATION_COUNT> counters_;
+};
+
+// Instrumentation points for Kitchen. `instrumentation` is a KitchenInstrumentation and `operation` an Operation.
+// Without KITCHEN_INSTRUMENTATION they expand to nothing, so their arguments are not evaluated.
+#ifdef KITCHEN_INSTRUMENTATION
+#define KITCHEN_INSTRUMENT_CALL(instrumentation, operation) \
+    KitchenInstrumentation::ScopedTimer kitchen_instrument_timer((instrumentation), (operation))
+#define KITCHEN_INSTRUMENT_MOVES(instrumentation, operation, count) (instrumentation).addMoves((operation), (count))
+#else
+#define KITCHEN_INSTRUMENT_CALL(instrumentation, operation) ((void)0)
+#define KITCHEN_INSTRUMENT_MOVES(instrumentation, operation, count) ((void)0)
+#endif
+
+#endif // KITCHEN_INSTRUMENTATION_HPP
@@ -0,0 +1,239 @@
+/**
+ * @file KitchenKernels.cpp
+ * @brief This file contains the implementation of the KitchenKernels class, the SIMD scan kernels used by KitchenColumns.
+ *
+ * The SSE2 and AVX2 versions are compiled with per-function target attributes, so the rest of the program does not
+ * need to be built with -mavx2. Comparison results are turned into bit masks with movemask and then into bytes with
+ * a 256-entry table.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenKernels.hpp"
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define KITCHEN_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+// Scalar versions, also used for the tail of the SIMD loops
+static int countPrepTimeBelowScalar(const int* prep_times, int count, int threshold) {
+    int below = 0;
+    for (int i = 0; i < count; ++i) {
+        below += (prep_times[i] < threshold);
+    }
+    return below;
+}
+
+static int markPrepTimeBelowScalar(const int* prep_times, int count, int threshold, std::uint8_t* mask) {
+    int marked = 0;
+    for (int i = 0; i < count; ++i) {
+        std::uint8_t below = (prep_times[i] < threshold);
+        mask[i] = below;
+        marked += below;
+    }
+    return marked;
+}
+
+static void byteHistogramScalar(const std::uint8_t* values, int count, int* counts, int bucket_count) {
+    for (int b = 0; b < bucket_count; ++b) {
+        counts[b] = 0;
+    }
+    for (int i = 0; i < count; ++i) {
+        if (values[i] < bucket_count) {
+            counts[values[i]]++;
+        }
+    }
+}
+
+#ifdef KITCHEN_KERNELS_X86
+
+// Table mapping the 8-bit result of a movemask to 8 mask bytes of 0 or 1
+struct MaskByteTable {
+    std::uint64_t bytes[256];
+    MaskByteTable() {
+        for (int bits = 0; bits < 256; ++bits) {
+            std::uint64_t expanded = 0;
+            for (int lane = 0; lane < 8; ++lane) {
+                if (bits & (1 << lane)) {
+                    expanded |= std::uint64_t(1) << (8 * lane);
+                }
+            }
+            bytes[bits] = expanded;
+        }
+    }
+};
+
+static const MaskByteTable mask_byte_table;
+
+__attribute__((target("sse2")))
+static int countPrepTimeBelowSse2(const int* prep_times, int count, int threshold) {
+    const __m128i limit = _mm_set1_epi32(threshold);
+    __m128i below = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(prep_times + i));
+        below = _mm_sub_epi32(below, _mm_cmplt_epi32(values, limit)); // true lanes are -1
+    }
+    alignas(16) int lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), below);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + countPrepTimeBelowScalar(prep_times + i, count - i, threshold);
+}
+
+__attribute__((target("sse2")))
+static int markPrepTimeBelowSse2(const int* prep_times, int count, int threshold, std::uint8_t* mask) {
+    const __m128i limit = _mm_set1_epi32(threshold);
+    int marked = 0;
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(prep_times + i));
+        __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(prep_times + i + 4));
+        int bits = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(low, limit)))
+                 | (_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(high, limit))) << 4);
+        std::memcpy(mask + i, &mask_byte_table.bytes[bits], 8);
+        marked += __builtin_popcount(bits);
+    }
+    return marked + markPrepTimeBelowScalar(prep_times + i, count - i, threshold, mask + i);
+}
+
+__attribute__((target("sse2")))
+static void byteHistogramSse2(const std::uint8_t* values, int count, int* counts, int bucket_count) {
+    for (int b = 0; b < bucket_count; ++b) {
+        counts[b] = 0;
+    }
+    int i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        for (int b = 0; b < bucket_count; ++b) {
+            __m128i match = _mm_cmpeq_epi8(block, _mm_set1_epi8(static_cast<char>(b)));
+            counts[b] += __builtin_popcount(_mm_movemask_epi8(match));
+        }
+    }
+    for (; i < count; ++i) {
+        if (values[i] < bucket_count) {
+            counts[values[i]]++;
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+static int countPrepTimeBelowAvx2(const int* prep_times, int count, int threshold) {
+    const __m256i limit = _mm256_set1_epi32(threshold);
+    __m256i below = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prep_times + i));
+        below = _mm256_sub_epi32(below, _mm256_cmpgt_epi32(limit, values)); // true lanes are -1
+    }
+    alignas(32) int lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), below);
+    int sum = 0;
+    for (int lane = 0; lane < 8; ++lane) {
+        sum += lanes[lane];
+    }
+    return sum + countPrepTimeBelowScalar(prep_times + i, count - i, threshold);
+}
+
+__attribute__((target("avx2,popcnt")))
+static int markPrepTimeBelowAvx2(const int* prep_times, int count, int threshold, std::uint8_t* mask) {
+    const __m256i limit = _mm256_set1_epi32(threshold);
+    int marked = 0;
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prep_times + i));
+        int bits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(limit, values)));
+        std::memcpy(mask + i, &mask_byte_table.bytes[bits], 8);
+        marked += __builtin_popcount(bits);
+    }
+    return marked + markPrepTimeBelowScalar(prep_times + i, count - i, threshold, mask + i);
+}
+
+__attribute__((target("avx2,popcnt")))
+static void byteHistogramAvx2(const std::uint8_t* values, int count, int* counts, int bucket_count) {
+    for (int b = 0; b < bucket_count; ++b) {
+        counts[b] = 0;
+    }
+    int i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        for (int b = 0; b < bucket_count; ++b) {
+            __m256i match = _mm256_cmpeq_epi8(block, _mm256_set1_epi8(static_cast<char>(b)));
+            counts[b] += __builtin_popcount(static_cast<unsigned>(_mm256_movemask_epi8(match)));
+        }
+    }
+    for (; i < count; ++i) {
+        if (values[i] < bucket_count) {
+            counts[values[i]]++;
+        }
+    }
+}
+
+#endif // KITCHEN_KERNELS_X86
+
+int KitchenKernels::countPrepTimeBelow(const int* prep_times, int count, int threshold) {
+    switch (selectedIsa().load(std::memory_order_relaxed)) {
+#ifdef KITCHEN_KERNELS_X86
+        case AVX2: return countPrepTimeBelowAvx2(prep_times, count, threshold);
+        case SSE2: return countPrepTimeBelowSse2(prep_times, count, threshold);
+#endif
+        default: return countPrepTimeBelowScalar(prep_times, count, threshold);
+    }
+}
+
+int KitchenKernels::markPrepTimeBelow(const int* prep_times, int count, int threshold, std::uint8_t* mask) {
+    switch (selectedIsa().load(std::memory_order_relaxed)) {
+#ifdef KITCHEN_KERNELS_X86
+        case AVX2: return markPrepTimeBelowAvx2(prep_times, count, threshold, mask);
+        case SSE2: return markPrepTimeBelowSse2(prep_times, count, threshold, mask);
+#endif
+        default: return markPrepTimeBelowScalar(prep_times, count, threshold, mask);
+    }
+}
+
+void KitchenKernels::byteHistogram(const std::uint8_t* values, int count, int* counts, int bucket_count) {
+    switch (selectedIsa().load(std::memory_order_relaxed)) {
+#ifdef KITCHEN_KERNELS_X86
+        case AVX2: byteHistogramAvx2(values, count, counts, bucket_count); break;
+        case SSE2: byteHistogramSse2(values, count, counts, bucket_count); break;
+#endif
+        default: byteHistogramScalar(values, count, counts, bucket_count); break;
+    }
+}
+
+KitchenKernels::Isa KitchenKernels::activeIsa() {
+    return selectedIsa().load(std::memory_order_relaxed);
+}
+
+KitchenKernels::Isa KitchenKernels::detectIsa() {
+#ifdef KITCHEN_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        return AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SSE2;
+    }
+#endif
+    return SCALAR;
+}
+
+void KitchenKernels::forceIsa(Isa isa) {
+    Isa supported = detectIsa();
+    selectedIsa().store((isa <= supported) ? isa : supported, std::memory_order_relaxed);
+}
+
+const char* KitchenKernels::isaName(Isa isa) {
+    switch (isa) {
+        case AVX2: return "AVX2";
+        case SSE2: return "SSE2";
+        default: return "SCALAR";
+    }
+}
+
+std::atomic<KitchenKernels::Isa>& KitchenKernels::selectedIsa() {
+    // The kernels only need some valid instruction set, so relaxed loads and stores are enough
+    static std::atomic<Isa> isa{detectIsa()};
+    return isa;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file KitchenKernels.hpp
+ * @brief This file contains the declaration of the KitchenKernels class, the SIMD scan kernels used by KitchenColumns.
+ *
+ * Each kernel has a scalar version and, on x86, SSE2 and AVX2 versions. The fastest version the CPU supports is
+ * picked once at runtime, so a single binary runs everywhere and uses AVX2 where it is available.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef KITCHEN_KERNELS_HPP
+#define KITCHEN_KERNELS_HPP
+
+#include <atomic>
+#include <cstdint>
+
+class KitchenKernels {
+public:
+    // Instruction sets a kernel can be implemented with, from slowest to fastest
+    enum Isa { SCALAR, SSE2, AVX2 };
+
+    /**
+     * @param prep_times A pointer to `count` preparation times.
+     * @param count The number of preparation times.
+     * @param threshold A preparation time in minutes.
+     * @return The number of preparation times less than the threshold.
+     */
+    static int countPrepTimeBelow(const int* prep_times, int count, int threshold);
+
+    /**
+     * @param prep_times A pointer to `count` preparation times.
+     * @param count The number of preparation times.
+     * @param threshold A preparation time in minutes.
+     * @param mask A pointer to `count` bytes, each set to 1 if the preparation time is less than the threshold, 0 otherwise.
+     * @return The number of bytes set to 1.
+     */
+    static int markPrepTimeBelow(const int* prep_times, int count, int threshold, std::uint8_t* mask);
+
+    /**
+     * @param values A pointer to `count` bytes. Bytes not less than `bucket_count` are not counted.
+     * @param count The number of bytes.
+     * @param counts A pointer to `bucket_count` integers receiving the number of bytes equal to each value.
+     * @param bucket_count The number of buckets, at most 255.
+     */
+    static void byteHistogram(const std::uint8_t* values, int count, int* counts, int bucket_count);
+
+    /**
+     * @return The instruction set the kernels currently dispatch to.
+     */
+    static Isa activeIsa();
+
+    /**
+     * @return The fastest instruction set supported by this CPU and build.
+     */
+    static Isa detectIsa();
+
+    /**
+     * @param isa The instruction set to dispatch to, e.g. to compare versions in a benchmark.
+     * @post Dispatches to `isa`, or to detectIsa() if the CPU does not support `isa`. May be called while kernels
+     * run on other threads; each kernel call reads the setting once, so it runs wholly on one instruction set.
+     */
+    static void forceIsa(Isa isa);
+
+    /**
+     * @param isa An instruction set.
+     * @return The name of the instruction set ("SCALAR", "SSE2" or "AVX2").
+     */
+    static const char* isaName(Isa isa);
+
+private:
+    /**
+     * @return A reference to the instruction set the kernels dispatch to, initialized with detectIsa().
+     */
+    static std::atomic<Isa>& selectedIsa();
+};
+
+#endif // KITCHEN_KERNELS_HPP
@@ -0,0 +1,90 @@
+/**
+ * @file KitchenObserver.hpp
+ * @brief This file contains the declaration of the KitchenObserver interface, notified of every change to a Kitchen.
+ *
+ * A Kitchen calls its registered observers from newOrder, newOrders, serveDish, serveDishes, the release functions,
+ * clear and assignment, passing the dish and the slot of items_ it occupies. Observers can therefore mirror the kitchen
+ * incrementally, without scanning or copying it. Callbacks run inside the mutation and must not modify the kitchen.
+ * KitchenEventLog is an observer that records the changes as a stream of compact events for readers to poll.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef KITCHEN_OBSERVER_HPP
+#define KITCHEN_OBSERVER_HPP
+
+#include "Dish.hpp"
+#include <algorithm>
+#include <vector>
+
+class KitchenObserver {
+public:
+    // Why a dish left the kitchen
+    enum RemovalReason { SERVED, RELEASED };
+
+    virtual ~KitchenObserver() = default;
+
+    /**
+     * @param a_dish A reference to the dish, already stored in the kitchen.
+     * @param slot The slot of items_ holding the dish.
+     */
+    virtual void dishAdded(const Dish& a_dish, int slot) { (void)a_dish; (void)slot; }
+
+    /**
+     * @param a_dish A reference to the dish, still stored in the kitchen but no longer counted.
+     * @param slot The slot of items_ the dish is removed from.
+     * @param reason Whether the dish was served or released.
+     */
+    virtual void dishRemoved(const Dish& a_dish, int slot, RemovalReason reason) { (void)a_dish; (void)slot; (void)reason; }
+
+    /**
+     * Called when a dish stays in the kitchen but moves to another slot, e.g. to fill the hole left by a removal.
+     * @param a_dish A reference to the dish, still stored at `from_slot`.
+     * @param from_slot The slot the dish is moved from.
+     * @param to_slot The slot the dish is moved to. Any dish there has already been reported removed or moved.
+     */
+    virtual void dishMoved(const Dish& a_dish, int from_slot, int to_slot) { (void)a_dish; (void)from_slot; (void)to_slot; }
+
+    /**
+     * Called when every dish is removed at once by `Kitchen::clear`, instead of one dishRemoved per dish. Assigning
+     * to a Kitchen calls it too, followed by one dishAdded per dish of the new contents.
+     */
+    virtual void kitchenCleared() {}
+};
+
+/**
+ * The observers registered with one Kitchen. Copying a Kitchen does not copy its observers, so the copy starts
+ * with an empty list and assigning to a Kitchen keeps the observers it already has; `Kitchen::operator=` then
+ * reports the new contents to them.
+ */
+class KitchenObserverList {
+public:
+    KitchenObserverList() = default;
+    KitchenObserverList(const KitchenObserverList&) {}
+    KitchenObserverList& operator=(const KitchenObserverList&) { return *this; }
+
+    void add(KitchenObserver* observer) { observers_.push_back(observer); }
+    void remove(KitchenObserver* observer) {
+        observers_.erase(std::remove(observers_.begin(), observers_.end(), observer), observers_.end());
+    }
+    bool empty() const { return observers_.empty(); }
+
+    void dishAdded(const Dish& a_dish, int slot) const {
+        for (KitchenObserver* observer : observers_) observer->dishAdded(a_dish, slot);
+    }
+    void dishRemoved(const Dish& a_dish, int slot, KitchenObserver::RemovalReason reason) const {
+        for (KitchenObserver* observer : observers_) observer->dishRemoved(a_dish, slot, reason);
+    }
+    void dishMoved(const Dish& a_dish, int from_slot, int to_slot) const {
+        for (KitchenObserver* observer : observers_) observer->dishMoved(a_dish, from_slot, to_slot);
+    }
+    void kitchenCleared() const {
+        for (KitchenObserver* observer : observers_) observer->kitchenCleared();
+    }
+
+private:
+    std::vector<KitchenObserver*> observers_;
+};
+
+#endif // KITCHEN_OBSERVER_HPP
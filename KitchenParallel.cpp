@@ -0,0 +1,161 @@
+/**
+ * @file KitchenParallel.cpp
+ * @brief This file contains the implementation of the KitchenParallel class, which splits scans over the slots of a
+ * Kitchen across threads.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenParallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::atomic<int> serial_threshold_setting{KitchenParallel::DEFAULT_SERIAL_THRESHOLD};
+std::atomic<int> max_workers_setting{0};  // 0 until set, meaning the number of hardware threads
+
+/**
+ * Worker threads kept between scans. Each scan bumps generation_; every worker below the scan's worker count runs
+ * its chunk, and the scan returns once pending_ drops to 0. Worker w runs chunk w, worker 0 being the caller.
+ */
+class WorkerPool {
+public:
+    typedef void (*ChunkFunction)(void* body, int worker, int begin, int end);
+
+    static WorkerPool& instance() {
+        static WorkerPool pool;
+        return pool;
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        work_ready_.notify_all();
+        for (std::thread& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    /**
+     * @return false, without running anything, if the pool is running another scan.
+     */
+    bool tryRun(int slot_count, int worker_count, ChunkFunction function, void* body) {
+        std::unique_lock<std::mutex> scan(scan_mutex_, std::try_to_lock);
+        if (!scan.owns_lock()) {
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            while (static_cast<int>(threads_.size()) < worker_count - 1) {
+                threads_.emplace_back(&WorkerPool::work, this, static_cast<int>(threads_.size()) + 1, generation_);
+            }
+            slot_count_ = slot_count;
+            worker_count_ = worker_count;
+            function_ = function;
+            body_ = body;
+            pending_ = worker_count - 1;
+            ++generation_;
+        }
+        work_ready_.notify_all();
+        function(body, 0, 0, KitchenParallel::chunkBegin(slot_count, worker_count, 1));
+        std::unique_lock<std::mutex> lock(mutex_);
+        work_done_.wait(lock, [this]() { return pending_ == 0; });
+        return true;
+    }
+
+private:
+    WorkerPool() = default;
+
+    void work(int worker, std::uint64_t seen_generation) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            work_ready_.wait(lock, [this, seen_generation]() { return stopping_ || generation_ != seen_generation; });
+            if (stopping_) {
+                return;
+            }
+            seen_generation = generation_;
+            if (worker >= worker_count_) {
+                continue;
+            }
+            int begin = KitchenParallel::chunkBegin(slot_count_, worker_count_, worker);
+            int end = KitchenParallel::chunkBegin(slot_count_, worker_count_, worker + 1);
+            ChunkFunction function = function_;
+            void* body = body_;
+            lock.unlock();
+            function(body, worker, begin, end);
+            lock.lock();
+            if (--pending_ == 0) {
+                work_done_.notify_one();
+            }
+        }
+    }
+
+    std::mutex scan_mutex_;  // held by the scan using the pool
+    std::mutex mutex_;       // guards the fields below
+    std::condition_variable work_ready_;
+    std::condition_variable work_done_;
+    std::vector<std::thread> threads_;
+    std::uint64_t generation_ = 0;
+    int slot_count_ = 0;
+    int worker_count_ = 0;
+    ChunkFunction function_ = nullptr;
+    void* body_ = nullptr;
+    int pending_ = 0;
+    bool stopping_ = false;
+};
+
+} // namespace
+
+int KitchenParallel::serialThreshold() {
+    return serial_threshold_setting.load(std::memory_order_relaxed);
+}
+
+void KitchenParallel::setSerialThreshold(int threshold) {
+    serial_threshold_setting.store(std::max(threshold, 1), std::memory_order_relaxed);
+}
+
+int KitchenParallel::maxWorkers() {
+    int workers = max_workers_setting.load(std::memory_order_relaxed);
+    if (workers > 0) {
+        return workers;
+    }
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+void KitchenParallel::setMaxWorkers(int max_workers) {
+    max_workers_setting.store(std::max(max_workers, 1), std::memory_order_relaxed);
+}
+
+int KitchenParallel::workerCount(int slot_count) {
+    int workers = maxWorkers();
+    if (slot_count < serialThreshold() || workers < 2) {
+        return 1;
+    }
+    return std::min(workers, std::max(2, slot_count / MIN_SLOTS_PER_WORKER));
+}
+
+void KitchenParallel::runChunks(int slot_count, int worker_count, ChunkFunction function, void* body) {
+    if (WorkerPool::instance().tryRun(slot_count, worker_count, function, body)) {
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(worker_count - 1);
+    for (int worker = 1; worker < worker_count; ++worker) {
+        threads.emplace_back(function, body, worker, chunkBegin(slot_count, worker_count, worker),
+                             chunkBegin(slot_count, worker_count, worker + 1));
+    }
+    function(body, 0, 0, chunkBegin(slot_count, worker_count, 1));
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
@@ -0,0 +1,101 @@
+/**
+ * @file KitchenParallel.hpp
+ * @brief This file contains the declaration of the KitchenParallel class, which splits scans over the slots of a
+ * Kitchen across threads.
+ *
+ * Work over `slot_count` slots is cut into one contiguous chunk per worker; worker 0 runs on the calling thread and
+ * the others on a process-wide pool of worker threads, which are started by the first parallel scan that needs them
+ * and then wait for the next one, so a scan costs a wake-up per worker rather than a thread start. The pool runs one
+ * scan at a time: a scan that finds it busy, e.g. on another thread or nested in a scan's body, starts threads for
+ * itself and joins them before it returns, which costs tens of microseconds. Handing out chunks still costs a few
+ * microseconds, so kitchens below serialThreshold() slots always run on the calling thread alone. The threshold and
+ * the worker limit are process-wide settings.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef KITCHEN_PARALLEL_HPP
+#define KITCHEN_PARALLEL_HPP
+
+class KitchenParallel {
+public:
+    // Default for serialThreshold(): below this many slots, scans stay serial
+    static const int DEFAULT_SERIAL_THRESHOLD = 1 << 16;
+
+    // Least number of slots given to each worker once a scan runs in parallel
+    static const int MIN_SLOTS_PER_WORKER = 1 << 14;
+
+    /**
+     * @return The number of slots from which scans run in parallel.
+     */
+    static int serialThreshold();
+
+    /**
+     * @param threshold The number of slots from which scans run in parallel, e.g. a small value to exercise the
+     * parallel code in tests. Values below 1 are taken as 1.
+     */
+    static void setSerialThreshold(int threshold);
+
+    /**
+     * @return The most workers a scan uses, by default the number of hardware threads.
+     */
+    static int maxWorkers();
+
+    /**
+     * @param max_workers The most workers a scan uses; 1 makes every scan serial.
+     */
+    static void setMaxWorkers(int max_workers);
+
+    /**
+     * @param slot_count The number of slots a scan covers.
+     * @return The number of workers to use: 1 below serialThreshold(), otherwise between 2 and maxWorkers().
+     */
+    static int workerCount(int slot_count);
+
+    /**
+     * @param slot_count The number of slots split between the workers.
+     * @param worker_count The number of workers.
+     * @param worker A worker from 0 to worker_count; worker_count gives the end of the last chunk.
+     * @return The first slot of the worker's chunk.
+     */
+    static int chunkBegin(int slot_count, int worker_count, int worker) {
+        return static_cast<int>(static_cast<long long>(slot_count) * worker / worker_count);
+    }
+
+    /**
+     * Runs `body(worker, begin, end)` once per worker, on the slots [begin, end) of its chunk, and returns when
+     * all have finished. `body` must not throw and must be safe to run concurrently on different chunks.
+     * @param slot_count The number of slots split between the workers.
+     * @param worker_count The number of workers, e.g. from workerCount(slot_count).
+     * @param body The work done on each chunk.
+     */
+    template<class Body>
+    static void forEachChunk(int slot_count, int worker_count, Body body);
+
+private:
+    typedef void (*ChunkFunction)(void* body, int worker, int begin, int end);
+
+    /**
+     * @param slot_count The number of slots split between the workers.
+     * @param worker_count The number of workers, at least 2.
+     * @param function Runs the body on one chunk. Worker 0 runs it on the calling thread.
+     * @param body The body passed to `function`.
+     */
+    static void runChunks(int slot_count, int worker_count, ChunkFunction function, void* body);
+};
+
+template<class Body>
+void KitchenParallel::forEachChunk(int slot_count, int worker_count, Body body)
+{
+    if (worker_count <= 1) {
+        body(0, 0, slot_count);
+        return;
+    }
+
+    runChunks(slot_count, worker_count, [](void* context, int worker, int begin, int end) {
+        (*static_cast<Body*>(context))(worker, begin, end);
+    }, &body);
+}
+
+#endif // KITCHEN_PARALLEL_HPP
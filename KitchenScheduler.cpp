@@ -0,0 +1,175 @@
+/**
+ * @file KitchenScheduler.cpp
+ * @brief This file contains the implementation of the KitchenScheduler class, which decides which dish the line should start next.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenScheduler.hpp"
+
+KitchenScheduler::KitchenScheduler(Kitchen& kitchen, Policy policy)
+    : kitchen_(kitchen), policy_(policy), next_arrival_(0) {
+    int dish_count = kitchen_.getCurrentSize();
+    heap_.reserve(dish_count);
+    for (int slot = 0; slot < dish_count; ++slot) {
+        dishAdded(kitchen_.getDishAt(slot), slot);
+    }
+    kitchen_.addObserver(this);
+}
+
+KitchenScheduler::~KitchenScheduler() {
+    kitchen_.removeObserver(this);
+}
+
+int KitchenScheduler::size() const {
+    return static_cast<int>(heap_.size());
+}
+
+const Dish* KitchenScheduler::nextDish() const {
+    if (heap_.empty()) {
+        return nullptr;
+    }
+    return &kitchen_.getDishAt(heap_[0].slot);
+}
+
+bool KitchenScheduler::serveNext() {
+    if (heap_.empty()) {
+        return false;
+    }
+    // The observer callbacks remove the entry from the heap
+    return kitchen_.serveDish(kitchen_.getDishAt(heap_[0].slot));
+}
+
+bool KitchenScheduler::setPriority(const Dish& a_dish, long long priority) {
+    int slot = kitchen_.getSlotOf(a_dish);
+    if (slot < 0) {
+        return false;
+    }
+    reprioritize(heap_position_[slot], priority);
+    return true;
+}
+
+bool KitchenScheduler::setDeadline(const Dish& a_dish, long long ready_by) {
+    return setPriority(a_dish, ready_by);
+}
+
+bool KitchenScheduler::bump(const Dish& a_dish, long long priority) {
+    int slot = kitchen_.getSlotOf(a_dish);
+    if (slot < 0 || priority >= heap_[heap_position_[slot]].priority) {
+        return false;
+    }
+    reprioritize(heap_position_[slot], priority);
+    return true;
+}
+
+long long KitchenScheduler::getPriority(const Dish& a_dish) const {
+    int slot = kitchen_.getSlotOf(a_dish);
+    if (slot < 0) {
+        return NO_DEADLINE;
+    }
+    return heap_[heap_position_[slot]].priority;
+}
+
+void KitchenScheduler::dishAdded(const Dish& a_dish, int slot) {
+    if (slot >= static_cast<int>(heap_position_.size())) {
+        heap_position_.resize(slot + 1, -1);
+    }
+    Entry entry = { initialPriority(a_dish), next_arrival_++, slot };
+    heap_.push_back(entry);
+    int position = static_cast<int>(heap_.size()) - 1;
+    heap_position_[slot] = position;
+    siftUp(position);
+}
+
+void KitchenScheduler::dishRemoved(const Dish& a_dish, int slot, RemovalReason reason) {
+    (void)a_dish;
+    (void)reason;
+    int position = heap_position_[slot];
+    heap_position_[slot] = -1;
+    eraseAt(position);
+}
+
+void KitchenScheduler::dishMoved(const Dish& a_dish, int from_slot, int to_slot) {
+    (void)a_dish;
+    int position = heap_position_[from_slot];
+    heap_position_[from_slot] = -1;
+    heap_position_[to_slot] = position;
+    heap_[position].slot = to_slot;
+}
+
+void KitchenScheduler::kitchenCleared() {
+    heap_.clear();
+    heap_position_.assign(heap_position_.size(), -1);
+}
+
+long long KitchenScheduler::initialPriority(const Dish& a_dish) const {
+    return policy_ == SHORTEST_PREP_FIRST ? a_dish.getPrepTime() : NO_DEADLINE;
+}
+
+bool KitchenScheduler::before(const Entry& lhs, const Entry& rhs) const {
+    if (lhs.priority != rhs.priority) {
+        return lhs.priority < rhs.priority;
+    }
+    return lhs.arrival < rhs.arrival;
+}
+
+void KitchenScheduler::place(int position, const Entry& entry) {
+    heap_[position] = entry;
+    heap_position_[entry.slot] = position;
+}
+
+void KitchenScheduler::siftUp(int position) {
+    Entry entry = heap_[position];
+    while (position > 0) {
+        int parent = (position - 1) / 2;
+        if (!before(entry, heap_[parent])) {
+            break;
+        }
+        place(position, heap_[parent]);
+        position = parent;
+    }
+    place(position, entry);
+}
+
+void KitchenScheduler::siftDown(int position) {
+    int count = static_cast<int>(heap_.size());
+    Entry entry = heap_[position];
+    for (;;) {
+        int child = 2 * position + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && before(heap_[child + 1], heap_[child])) {
+            child++;
+        }
+        if (!before(heap_[child], entry)) {
+            break;
+        }
+        place(position, heap_[child]);
+        position = child;
+    }
+    place(position, entry);
+}
+
+void KitchenScheduler::eraseAt(int position) {
+    int last = static_cast<int>(heap_.size()) - 1;
+    if (position != last) {
+        place(position, heap_[last]);
+        heap_.pop_back();
+        siftDown(position);
+        siftUp(position);
+    } else {
+        heap_.pop_back();
+    }
+}
+
+void KitchenScheduler::reprioritize(int position, long long priority) {
+    long long old_priority = heap_[position].priority;
+    heap_[position].priority = priority;
+    if (priority < old_priority) {
+        siftUp(position);
+    } else {
+        siftDown(position);
+    }
+}
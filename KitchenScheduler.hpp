@@ -0,0 +1,130 @@
+/**
+ * @file KitchenScheduler.hpp
+ * @brief This file contains the declaration of the KitchenScheduler class, which decides which dish the line should start next.
+ *
+ * KitchenScheduler keeps an indexed binary min-heap over the dishes of one Kitchen, ordered either by preparation
+ * time (shortest first) or by a ready-by deadline attached to each order (earliest first); ties go to the order that
+ * arrived first. The scheduler observes the kitchen, so dishes added, served or released through any Kitchen function
+ * enter and leave the heap automatically. Each heap entry records the kitchen slot of its dish, and the scheduler
+ * maps every slot back to its heap position, so all updates are O(log n) and no dish is copied or hashed.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef KITCHEN_SCHEDULER_HPP
+#define KITCHEN_SCHEDULER_HPP
+
+#include "Kitchen.hpp"
+#include "KitchenObserver.hpp"
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+class KitchenScheduler : private KitchenObserver {
+public:
+    // What the heap is ordered by
+    enum Policy { SHORTEST_PREP_FIRST, EARLIEST_DEADLINE_FIRST };
+
+    // Deadline of orders that have not been given one; they are scheduled after all orders that have
+    static const long long NO_DEADLINE = LLONG_MAX;
+
+    /**
+     * Parameterized constructor.
+     * @param kitchen A reference to the kitchen to schedule. It must outlive the scheduler.
+     * @param policy What the heap is ordered by.
+     * @post The dishes already in the kitchen are scheduled, and later changes are followed.
+     */
+    explicit KitchenScheduler(Kitchen& kitchen, Policy policy = SHORTEST_PREP_FIRST);
+
+    /**
+     * Destructor.
+     * Stops observing the kitchen.
+     */
+    ~KitchenScheduler();
+
+    KitchenScheduler(const KitchenScheduler&) = delete;
+    KitchenScheduler& operator=(const KitchenScheduler&) = delete;
+
+    /**
+     * @return The number of dishes scheduled, which is the number of dishes in the kitchen.
+     */
+    int size() const;
+
+    /**
+     * @return A pointer to the dish the line should start next, or nullptr if the kitchen is empty.
+     * The pointer is valid until the kitchen changes.
+     */
+    const Dish* nextDish() const;
+
+    /**
+     * @post Serves the dish returned by nextDish() through `Kitchen::serveDish`.
+     * @return True if a dish was served, false if the kitchen is empty.
+     */
+    bool serveNext();
+
+    /**
+     * @param a_dish A reference to a dish in the kitchen.
+     * @param priority The new priority of the dish: a preparation time under SHORTEST_PREP_FIRST,
+     * a ready-by deadline under EARLIEST_DEADLINE_FIRST. Lower values are scheduled sooner.
+     * @return True if the dish is in the kitchen and was rescheduled, false otherwise.
+     */
+    bool setPriority(const Dish& a_dish, long long priority);
+
+    /**
+     * Attaches a ready-by deadline to an order. Same as setPriority; intended for EARLIEST_DEADLINE_FIRST.
+     * @param a_dish A reference to a dish in the kitchen.
+     * @param ready_by The time by which the dish must be ready.
+     * @return True if the dish is in the kitchen and was rescheduled, false otherwise.
+     */
+    bool setDeadline(const Dish& a_dish, long long ready_by);
+
+    /**
+     * Moves an order forward (decrease-key).
+     * @param a_dish A reference to a dish in the kitchen.
+     * @param priority The new priority, lower than the dish's current one.
+     * @return True if the dish was moved forward, false if it is not in the kitchen or the priority is not lower.
+     */
+    bool bump(const Dish& a_dish, long long priority);
+
+    /**
+     * @param a_dish A reference to a dish.
+     * @return The current priority of the dish, or NO_DEADLINE if it is not in the kitchen.
+     */
+    long long getPriority(const Dish& a_dish) const;
+
+private:
+    struct Entry {
+        long long priority;
+        std::uint64_t arrival;  // tie-breaker, lower arrived first
+        int slot;               // slot of the dish in the kitchen
+    };
+
+    Kitchen& kitchen_;
+    Policy policy_;
+    std::vector<Entry> heap_;
+    std::vector<int> heap_position_;  // slot -> position in heap_, -1 if unused
+    std::uint64_t next_arrival_;
+
+    // KitchenObserver
+    void dishAdded(const Dish& a_dish, int slot) override;
+    void dishRemoved(const Dish& a_dish, int slot, RemovalReason reason) override;
+    void dishMoved(const Dish& a_dish, int from_slot, int to_slot) override;
+    void kitchenCleared() override;
+
+    /**
+     * @param a_dish A reference to a dish entering the kitchen.
+     * @return The priority the dish starts with under the current policy.
+     */
+    long long initialPriority(const Dish& a_dish) const;
+
+    // Heap maintenance; each keeps heap_position_ in step with heap_
+    bool before(const Entry& lhs, const Entry& rhs) const;
+    void place(int position, const Entry& entry);
+    void siftUp(int position);
+    void siftDown(int position);
+    void eraseAt(int position);
+    void reprioritize(int position, long long priority);
+};
+
+#endif // KITCHEN_SCHEDULER_HPP
@@ -0,0 +1,359 @@
+/**
+ * @file KitchenSnapshot.cpp
+ * @brief This file contains the implementation of the Kitchen binary snapshot writer and zero-copy reader.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenSnapshot.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define KITCHEN_SNAPSHOT_MMAP 1
+#endif
+
+namespace {
+
+const std::size_t SECTION_ALIGNMENT = 8;
+
+std::uint64_t alignUp(std::uint64_t offset) {
+    return (offset + SECTION_ALIGNMENT - 1) & ~std::uint64_t(SECTION_ALIGNMENT - 1);
+}
+
+bool writePadding(std::ostream& out, std::uint64_t written, std::uint64_t target) {
+    static const char zeros[SECTION_ALIGNMENT] = {};
+    out.write(zeros, static_cast<std::streamsize>(target - written));
+    return static_cast<bool>(out);
+}
+
+// True if [offset, offset + length) lies inside a region of `size` bytes
+bool inBounds(std::uint64_t offset, std::uint64_t length, std::uint64_t size) {
+    return offset <= size && length <= size - offset;
+}
+
+} // namespace
+
+KitchenSnapshotWriter::KitchenSnapshotWriter() : header_(), overflowed_(false) {
+    std::memcpy(header_.magic, KitchenSnapshotHeader::MAGIC, sizeof(header_.magic));
+    header_.version = KitchenSnapshotHeader::CURRENT_VERSION;
+    header_.byte_order = KitchenSnapshotHeader::BYTE_ORDER_MARK;
+    header_.cuisine_type_count = Dish::CUISINE_TYPE_COUNT;
+}
+
+void KitchenSnapshotWriter::addDish(const Dish& a_dish, bool elaborate) {
+    KitchenSnapshotRecord record = {};
+    KitchenSnapshotString name = addString(a_dish.getName());
+    record.price_cents = a_dish.getPriceValue().cents();
+    record.name_offset = name.offset;
+    record.name_length = name.length;
+    record.first_ingredient = static_cast<std::uint32_t>(ingredient_refs_.size());
+    record.ingredient_count = static_cast<std::uint32_t>(a_dish.getIngredientCount());
+    record.prep_time = a_dish.getPrepTime();
+    record.cuisine_type = static_cast<std::uint8_t>(a_dish.getCuisineTypeEnum());
+    record.elaborate = elaborate ? 1 : 0;
+    for (int i = 0; i < a_dish.getIngredientCount(); ++i) {
+        ingredient_refs_.push_back(addString(a_dish.getIngredient(i)));
+    }
+    records_.push_back(record);
+    if (records_.size() > std::numeric_limits<std::uint32_t>::max() ||
+        ingredient_refs_.size() > std::numeric_limits<std::uint32_t>::max()) {
+        overflowed_ = true;
+    }
+}
+
+void KitchenSnapshotWriter::setTotals(long long total_prep_time, Price total_revenue, int elaborate_count,
+                                      const std::array<int, Dish::CUISINE_TYPE_COUNT>& cuisine_counts) {
+    header_.total_prep_time = total_prep_time;
+    header_.total_revenue_cents = total_revenue.cents();
+    header_.elaborate_count = elaborate_count;
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+        header_.cuisine_counts[c] = cuisine_counts[c];
+    }
+}
+
+bool KitchenSnapshotWriter::writeTo(std::ostream& out) const {
+    if (overflowed_) {
+        return false;
+    }
+
+    KitchenSnapshotHeader header = header_;
+    header.dish_count = static_cast<std::uint32_t>(records_.size());
+    header.ingredient_ref_count = static_cast<std::uint32_t>(ingredient_refs_.size());
+    header.records_offset = alignUp(sizeof(KitchenSnapshotHeader));
+    header.ingredient_refs_offset = alignUp(header.records_offset + records_.size() * sizeof(KitchenSnapshotRecord));
+    header.strings_offset = alignUp(header.ingredient_refs_offset +
+                                    ingredient_refs_.size() * sizeof(KitchenSnapshotString));
+    header.strings_size = strings_.size();
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!writePadding(out, sizeof(header), header.records_offset)) {
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(records_.data()),
+              static_cast<std::streamsize>(records_.size() * sizeof(KitchenSnapshotRecord)));
+    if (!writePadding(out, header.records_offset + records_.size() * sizeof(KitchenSnapshotRecord),
+                      header.ingredient_refs_offset)) {
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(ingredient_refs_.data()),
+              static_cast<std::streamsize>(ingredient_refs_.size() * sizeof(KitchenSnapshotString)));
+    if (!writePadding(out, header.ingredient_refs_offset + ingredient_refs_.size() * sizeof(KitchenSnapshotString),
+                      header.strings_offset)) {
+        return false;
+    }
+    out.write(strings_.data(), static_cast<std::streamsize>(strings_.size()));
+    return static_cast<bool>(out);
+}
+
+KitchenSnapshotString KitchenSnapshotWriter::addString(const std::string& value) {
+    KitchenSnapshotString location = { 0, static_cast<std::uint32_t>(value.size()) };
+    auto found = string_offsets_.find(value);
+    if (found != string_offsets_.end()) {
+        location.offset = found->second;
+        return location;
+    }
+    if (strings_.size() + value.size() > std::numeric_limits<std::uint32_t>::max()) {
+        overflowed_ = true;
+        return location;
+    }
+    location.offset = static_cast<std::uint32_t>(strings_.size());
+    strings_ += value;
+    string_offsets_.emplace(value, location.offset);
+    return location;
+}
+
+KitchenSnapshotView::KitchenSnapshotView() : data_(nullptr), size_(0), mapping_(nullptr), mapping_size_(0) {
+}
+
+KitchenSnapshotView::~KitchenSnapshotView() {
+    close();
+}
+
+KitchenSnapshotView::KitchenSnapshotView(KitchenSnapshotView&& other) noexcept
+    : data_(other.data_), size_(other.size_), mapping_(other.mapping_), mapping_size_(other.mapping_size_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.mapping_ = nullptr;
+    other.mapping_size_ = 0;
+}
+
+KitchenSnapshotView& KitchenSnapshotView::operator=(KitchenSnapshotView&& other) noexcept {
+    if (this != &other) {
+        close();
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(mapping_, other.mapping_);
+        std::swap(mapping_size_, other.mapping_size_);
+    }
+    return *this;
+}
+
+bool KitchenSnapshotView::open(const std::string& path) {
+    close();
+#ifdef KITCHEN_SNAPSHOT_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat file_status;
+    if (::fstat(fd, &file_status) != 0 || file_status.st_size < static_cast<off_t>(sizeof(KitchenSnapshotHeader))) {
+        ::close(fd);
+        return false;
+    }
+    std::size_t file_size = static_cast<std::size_t>(file_status.st_size);
+    void* mapping = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    mapping_ = mapping;
+    mapping_size_ = file_size;
+    data_ = static_cast<const char*>(mapping);
+    size_ = file_size;
+#else
+    // Without mmap, read the file into memory the view owns
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        return false;
+    }
+    std::size_t file_size = static_cast<std::size_t>(in.tellg());
+    char* buffer = new char[file_size + SECTION_ALIGNMENT];
+    in.seekg(0);
+    if (!in.read(buffer, static_cast<std::streamsize>(file_size))) {
+        delete[] buffer;
+        return false;
+    }
+    mapping_ = buffer;
+    mapping_size_ = file_size;
+    data_ = buffer;
+    size_ = file_size;
+#endif
+    if (!validate()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool KitchenSnapshotView::openBuffer(const void* data, std::size_t size) {
+    close();
+    if (data == nullptr || reinterpret_cast<std::uintptr_t>(data) % SECTION_ALIGNMENT != 0) {
+        return false;
+    }
+    data_ = static_cast<const char*>(data);
+    size_ = size;
+    if (!validate()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void KitchenSnapshotView::close() {
+    if (mapping_ != nullptr) {
+#ifdef KITCHEN_SNAPSHOT_MMAP
+        ::munmap(mapping_, mapping_size_);
+#else
+        delete[] static_cast<char*>(mapping_);
+#endif
+    }
+    data_ = nullptr;
+    size_ = 0;
+    mapping_ = nullptr;
+    mapping_size_ = 0;
+}
+
+bool KitchenSnapshotView::isOpen() const {
+    return data_ != nullptr;
+}
+
+const KitchenSnapshotHeader& KitchenSnapshotView::header() const {
+    return *reinterpret_cast<const KitchenSnapshotHeader*>(data_);
+}
+
+int KitchenSnapshotView::dishCount() const {
+    return isOpen() ? static_cast<int>(header().dish_count) : 0;
+}
+
+const KitchenSnapshotRecord& KitchenSnapshotView::record(int index) const {
+    const KitchenSnapshotRecord* records =
+        reinterpret_cast<const KitchenSnapshotRecord*>(data_ + header().records_offset);
+    return records[index];
+}
+
+std::string_view KitchenSnapshotView::name(int index) const {
+    const KitchenSnapshotRecord& dish_record = record(index);
+    return heapString(KitchenSnapshotString{ dish_record.name_offset, dish_record.name_length });
+}
+
+std::string_view KitchenSnapshotView::ingredient(int index, int ingredient) const {
+    const KitchenSnapshotString* refs =
+        reinterpret_cast<const KitchenSnapshotString*>(data_ + header().ingredient_refs_offset);
+    return heapString(refs[record(index).first_ingredient + ingredient]);
+}
+
+Dish KitchenSnapshotView::dishAt(int index, IngredientListPool& pool) const {
+    const KitchenSnapshotRecord& dish_record = record(index);
+    std::vector<std::string_view> ingredients;
+    ingredients.reserve(dish_record.ingredient_count);
+    for (std::uint32_t i = 0; i < dish_record.ingredient_count; ++i) {
+        ingredients.push_back(ingredient(index, static_cast<int>(i)));
+    }
+    return Dish::fromFields(name(index), ingredients.data(), ingredients.size(), dish_record.prep_time,
+                            Price::fromCents(dish_record.price_cents),
+                            static_cast<Dish::CuisineType>(dish_record.cuisine_type), pool);
+}
+
+bool KitchenSnapshotView::hasDistinctValidDishes() const {
+    std::vector<int> order(static_cast<std::size_t>(dishCount()));
+    for (int i = 0; i < dishCount(); ++i) {
+        if (!Dish::isValidName(name(i))) {
+            return false;
+        }
+        order[i] = i;
+    }
+
+    // Sorting by the fields Dish::operator== compares puts equal dishes next to each other
+    auto key = [this](int index) {
+        const KitchenSnapshotRecord& dish_record = record(index);
+        return std::make_tuple(name(index), dish_record.cuisine_type, dish_record.prep_time, dish_record.price_cents);
+    };
+    std::sort(order.begin(), order.end(), [&key](int lhs, int rhs) { return key(lhs) < key(rhs); });
+    for (std::size_t i = 1; i < order.size(); ++i) {
+        if (key(order[i - 1]) == key(order[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool KitchenSnapshotView::validate() const {
+    if (size_ < sizeof(KitchenSnapshotHeader)) {
+        return false;
+    }
+    const KitchenSnapshotHeader& file_header = header();
+    if (std::memcmp(file_header.magic, KitchenSnapshotHeader::MAGIC, sizeof(file_header.magic)) != 0 ||
+        file_header.version != KitchenSnapshotHeader::CURRENT_VERSION ||
+        file_header.byte_order != KitchenSnapshotHeader::BYTE_ORDER_MARK ||
+        file_header.cuisine_type_count != static_cast<std::uint32_t>(Dish::CUISINE_TYPE_COUNT)) {
+        return false;
+    }
+    if (file_header.records_offset % SECTION_ALIGNMENT != 0 || file_header.ingredient_refs_offset % SECTION_ALIGNMENT != 0 ||
+        !inBounds(file_header.records_offset, std::uint64_t(file_header.dish_count) * sizeof(KitchenSnapshotRecord), size_) ||
+        !inBounds(file_header.ingredient_refs_offset,
+                  std::uint64_t(file_header.ingredient_ref_count) * sizeof(KitchenSnapshotString), size_) ||
+        !inBounds(file_header.strings_offset, file_header.strings_size, size_) ||
+        file_header.dish_count > static_cast<std::uint32_t>(std::numeric_limits<int>::max())) {
+        return false;
+    }
+
+    // The running totals in the header must be those of the records
+    const KitchenSnapshotString* refs =
+        reinterpret_cast<const KitchenSnapshotString*>(data_ + file_header.ingredient_refs_offset);
+    std::int64_t prep_time_total = 0;
+    std::int64_t revenue_cents_total = 0;
+    std::int64_t elaborate_total = 0;
+    std::array<std::int64_t, Dish::CUISINE_TYPE_COUNT> cuisine_totals{};
+    for (int i = 0; i < static_cast<int>(file_header.dish_count); ++i) {
+        const KitchenSnapshotRecord& dish_record = record(i);
+        if (dish_record.cuisine_type >= Dish::CUISINE_TYPE_COUNT ||
+            !inBounds(dish_record.name_offset, dish_record.name_length, file_header.strings_size) ||
+            !inBounds(dish_record.first_ingredient, dish_record.ingredient_count, file_header.ingredient_ref_count)) {
+            return false;
+        }
+        prep_time_total += dish_record.prep_time;
+        revenue_cents_total += dish_record.price_cents;
+        elaborate_total += dish_record.elaborate != 0;
+        cuisine_totals[dish_record.cuisine_type]++;
+    }
+    if (prep_time_total != file_header.total_prep_time || revenue_cents_total != file_header.total_revenue_cents ||
+        elaborate_total != file_header.elaborate_count) {
+        return false;
+    }
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+        if (cuisine_totals[c] != file_header.cuisine_counts[c]) {
+            return false;
+        }
+    }
+    for (std::uint32_t i = 0; i < file_header.ingredient_ref_count; ++i) {
+        if (!inBounds(refs[i].offset, refs[i].length, file_header.strings_size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string_view KitchenSnapshotView::heapString(const KitchenSnapshotString& location) const {
+    return std::string_view(data_ + header().strings_offset + location.offset, location.length);
+}
@@ -0,0 +1,224 @@
+/**
+ * @file KitchenSnapshot.hpp
+ * @brief This file contains the declarations of the Kitchen binary snapshot format, its writer and a zero-copy
+ * reader.
+ *
+ * A snapshot file is laid out as:
+ *
+ *     KitchenSnapshotHeader                 magic, version, counts, section offsets and the kitchen's running totals
+ *     KitchenSnapshotRecord[dish_count]     one fixed-width record per dish, in kitchen order
+ *     KitchenSnapshotString[ref_count]      the ingredients of all dishes, each record owning a contiguous run
+ *     char[strings_size]                    string heap: every distinct name and ingredient stored once
+ *
+ * Sections start on 8-byte boundaries and all integers are in the byte order of the machine that wrote the file;
+ * the header records that order and readers reject files with a different one. KitchenSnapshotView maps a file
+ * into memory and reads records and strings in place, without copying or parsing. Kitchen::restoreSnapshot rebuilds
+ * a kitchen from a view. Opening a view checks that the running totals in the header are those of the records.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef KITCHEN_SNAPSHOT_HPP
+#define KITCHEN_SNAPSHOT_HPP
+
+#include "Dish.hpp"
+#include "Price.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+struct KitchenSnapshotHeader {
+    static constexpr char MAGIC[8] = { 'K', 'I', 'T', 'C', 'H', 'E', 'N', '\0' };
+    static const std::uint32_t CURRENT_VERSION = 1;
+    static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint32_t dish_count;
+    std::uint32_t ingredient_ref_count;
+    std::uint32_t cuisine_type_count;      // Dish::CUISINE_TYPE_COUNT of the writer
+    std::int32_t elaborate_count;
+    std::uint64_t records_offset;
+    std::uint64_t ingredient_refs_offset;
+    std::uint64_t strings_offset;
+    std::uint64_t strings_size;
+    std::int64_t total_prep_time;
+    std::int64_t total_revenue_cents;
+    std::int32_t cuisine_counts[Dish::CUISINE_TYPE_COUNT];
+};
+
+struct KitchenSnapshotRecord {
+    std::int64_t price_cents;
+    std::uint32_t name_offset;        // into the string heap
+    std::uint32_t name_length;
+    std::uint32_t first_ingredient;   // into the ingredient table
+    std::uint32_t ingredient_count;
+    std::int32_t prep_time;
+    std::uint8_t cuisine_type;
+    std::uint8_t elaborate;           // 1 if the kitchen counted the dish as elaborate
+    std::uint16_t reserved;
+};
+
+struct KitchenSnapshotString {
+    std::uint32_t offset;             // into the string heap
+    std::uint32_t length;
+};
+
+static_assert(std::is_trivially_copyable<KitchenSnapshotHeader>::value, "snapshot header is written with memcpy");
+static_assert(sizeof(KitchenSnapshotRecord) == 32, "snapshot records are fixed-width");
+static_assert(sizeof(KitchenSnapshotString) == 8, "snapshot string references are fixed-width");
+
+class KitchenSnapshotWriter {
+public:
+    /**
+     * Default constructor.
+     * Starts an empty snapshot with zero totals.
+     */
+    KitchenSnapshotWriter();
+
+    /**
+     * @param a_dish A reference to the next dish of the kitchen.
+     * @param elaborate Whether the kitchen counts the dish as elaborate.
+     * @post Appends a record for the dish, adding its name and ingredients to the string heap if they are new.
+     */
+    void addDish(const Dish& a_dish, bool elaborate);
+
+    /**
+     * @post Stores the kitchen's running totals in the header.
+     */
+    void setTotals(long long total_prep_time, Price total_revenue, int elaborate_count,
+                   const std::array<int, Dish::CUISINE_TYPE_COUNT>& cuisine_counts);
+
+    /**
+     * @param out A reference to a binary output stream.
+     * @return True if the whole snapshot was written, false if the stream failed or the string heap is too large.
+     */
+    bool writeTo(std::ostream& out) const;
+
+private:
+    KitchenSnapshotHeader header_;
+    std::vector<KitchenSnapshotRecord> records_;
+    std::vector<KitchenSnapshotString> ingredient_refs_;
+    std::string strings_;
+    std::unordered_map<std::string, std::uint32_t> string_offsets_;  // string -> offset in strings_
+    bool overflowed_;                                                // a count or offset exceeded 32 bits
+
+    /**
+     * @return The location of the string in the heap, adding it if it is new.
+     */
+    KitchenSnapshotString addString(const std::string& value);
+};
+
+class KitchenSnapshotView {
+public:
+    /**
+     * Default constructor.
+     * Creates a view that is not open.
+     */
+    KitchenSnapshotView();
+
+    /**
+     * Destructor.
+     * Unmaps the file, if one is open.
+     */
+    ~KitchenSnapshotView();
+
+    KitchenSnapshotView(const KitchenSnapshotView&) = delete;
+    KitchenSnapshotView& operator=(const KitchenSnapshotView&) = delete;
+    KitchenSnapshotView(KitchenSnapshotView&& other) noexcept;
+    KitchenSnapshotView& operator=(KitchenSnapshotView&& other) noexcept;
+
+    /**
+     * @param path The path of a snapshot file.
+     * @post Maps the file read-only into memory and checks its header and every record's references.
+     * @return True if the file is a valid snapshot of this version and byte order, false otherwise (the view is
+     * then closed).
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @param data A pointer to a snapshot in memory, aligned to 8 bytes. It is not copied and must outlive the view.
+     * @param size The number of bytes at `data`.
+     * @return True if the buffer is a valid snapshot, see `open`.
+     */
+    bool openBuffer(const void* data, std::size_t size);
+
+    /**
+     * @post Releases the mapping; the view is no longer open.
+     */
+    void close();
+
+    /**
+     * @return True if the view holds a valid snapshot.
+     */
+    bool isOpen() const;
+
+    /**
+     * @return A reference to the header, including the kitchen's running totals. The view must be open.
+     */
+    const KitchenSnapshotHeader& header() const;
+
+    /**
+     * @return The number of dishes in the snapshot.
+     */
+    int dishCount() const;
+
+    /**
+     * @param index The position of a dish, from 0 to dishCount() - 1.
+     * @return A reference to the dish's record, inside the mapping.
+     */
+    const KitchenSnapshotRecord& record(int index) const;
+
+    /**
+     * @param index The position of a dish.
+     * @return The dish's name, viewing the mapping.
+     */
+    std::string_view name(int index) const;
+
+    /**
+     * @param index The position of a dish.
+     * @param ingredient The position of an ingredient, from 0 to record(index).ingredient_count - 1.
+     * @return The ingredient, viewing the mapping.
+     */
+    std::string_view ingredient(int index, int ingredient) const;
+
+    /**
+     * @param index The position of a dish.
+     * @param pool The pool the dish's ingredient list is interned in, e.g. the arena of the kitchen being restored.
+     * @return A Dish with the recorded name, ingredients, preparation time, price and cuisine type.
+     */
+    Dish dishAt(int index, IngredientListPool& pool = IngredientListPool::global()) const;
+
+    /**
+     * @return True if every dish has a name Dish accepts and no two dishes are equal, as in any kitchen that could
+     * have saved the snapshot. `dishAt` replaces an invalid name with "UNKNOWN", which could make two dishes equal.
+     */
+    bool hasDistinctValidDishes() const;
+
+private:
+    const char* data_;
+    std::size_t size_;
+    void* mapping_;              // what to unmap, nullptr for a caller's buffer
+    std::size_t mapping_size_;
+
+    /**
+     * @return True if the header and every reference in the records lie inside the buffer, and the running totals
+     * in the header equal those computed from the records.
+     */
+    bool validate() const;
+
+    /**
+     * @return The string at the given location of the heap.
+     */
+    std::string_view heapString(const KitchenSnapshotString& location) const;
+};
+
+#endif // KITCHEN_SNAPSHOT_HPP
@@ -0,0 +1,185 @@
+/**
+ * @file KitchenStats.cpp
+ * @brief This file contains the implementation of the KitchenStats class, the mergeable summary behind a kitchen report.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenStats.hpp"
+#include "TextFormat.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace {
+
+struct KitchenStatsRecord {
+    static constexpr char MAGIC[8] = { 'K', 'S', 'T', 'A', 'T', 'S', '\0', '\0' };
+    static const std::uint32_t CURRENT_VERSION = 1;
+    static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint32_t cuisine_type_count;      // Dish::CUISINE_TYPE_COUNT of the writer
+    std::uint32_t bucket_count;            // PrepTimeSketch::BUCKET_COUNT of the writer
+    std::int64_t dish_count;
+    std::int64_t prep_time_sum;
+    std::int64_t revenue_cents;
+    std::int64_t elaborate_count;
+    std::int64_t cuisine_counts[Dish::CUISINE_TYPE_COUNT];
+    std::int64_t buckets[PrepTimeSketch::BUCKET_COUNT];
+};
+
+constexpr char KitchenStatsRecord::MAGIC[8];
+
+static_assert(std::is_trivially_copyable<KitchenStatsRecord>::value, "stats records are written with memcpy");
+
+} // namespace
+
+KitchenStats::KitchenStats() : dish_count_(0), prep_time_sum_(0), revenue_(), elaborate_count_(0) {
+    cuisine_counts_.fill(0);
+}
+
+KitchenStats::KitchenStats(long long dish_count, long long prep_time_sum, Price revenue, long long elaborate_count,
+                           const std::array<long long, Dish::CUISINE_TYPE_COUNT>& cuisine_counts,
+                           const PrepTimeSketch& prep_times)
+    : dish_count_(dish_count), prep_time_sum_(prep_time_sum), revenue_(revenue), elaborate_count_(elaborate_count),
+      cuisine_counts_(cuisine_counts), prep_times_(prep_times) {
+}
+
+KitchenStats& KitchenStats::merge(const KitchenStats& other) {
+    dish_count_ += other.dish_count_;
+    prep_time_sum_ += other.prep_time_sum_;
+    revenue_ += other.revenue_;
+    elaborate_count_ += other.elaborate_count_;
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+        cuisine_counts_[c] += other.cuisine_counts_[c];
+    }
+    prep_times_.merge(other.prep_times_);
+    return *this;
+}
+
+int KitchenStats::averagePrepTime(long long prep_time_sum, long long dish_count) {
+    return (prep_time_sum > 0 && dish_count > 0)
+        ? static_cast<int>(std::round(double(prep_time_sum) / dish_count)) : 0;
+}
+
+double KitchenStats::elaboratePercentage(long long elaborate_count, long long dish_count) {
+    if (elaborate_count <= 0 || dish_count <= 0) {
+        return 0.0;
+    }
+    // Hundredths of a percent, rounded up exactly: ceil(10000 * elaborate_count / dish_count)
+    long long hundredths = (10000 * elaborate_count + dish_count - 1) / dish_count;
+    return hundredths / 100.0;
+}
+
+int KitchenStats::calculateAvgPrepTime() const {
+    return averagePrepTime(prep_time_sum_, dish_count_);
+}
+
+double KitchenStats::calculateElaboratePercentage() const {
+    return elaboratePercentage(elaborate_count_, dish_count_);
+}
+
+int KitchenStats::prepTimePercentile(double percent) const {
+    return prep_times_.percentile(percent);
+}
+
+void KitchenStats::kitchenReport(std::ostream& out) const {
+    std::string buffer;
+    appendReport(buffer);
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+void KitchenStats::appendReport(std::string& buffer) const {
+    appendReport(buffer, cuisine_counts_, prep_time_sum_, elaborate_count_, dish_count_);
+}
+
+void KitchenStats::appendReport(std::string& buffer, const std::array<long long, Dish::CUISINE_TYPE_COUNT>& cuisine_counts,
+                                long long prep_time_sum, long long elaborate_count, long long dish_count) {
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+        buffer += Dish::CUISINE_TYPE_NAMES[c];
+        buffer += ": ";
+        appendInteger(buffer, cuisine_counts[c]);
+        buffer += '\n';
+    }
+    buffer += "\nAVERAGE PREP TIME: ";
+    appendInteger(buffer, averagePrepTime(prep_time_sum, dish_count));
+    buffer += "\nELABORATE DISHES: ";
+    appendFixed2(buffer, elaboratePercentage(elaborate_count, dish_count));
+    buffer += "%.\n\n";
+}
+
+void KitchenStats::serialize(std::string& buffer) const {
+    KitchenStatsRecord record;
+    std::memcpy(record.magic, KitchenStatsRecord::MAGIC, sizeof(record.magic));
+    record.version = KitchenStatsRecord::CURRENT_VERSION;
+    record.byte_order = KitchenStatsRecord::BYTE_ORDER_MARK;
+    record.cuisine_type_count = Dish::CUISINE_TYPE_COUNT;
+    record.bucket_count = PrepTimeSketch::BUCKET_COUNT;
+    record.dish_count = dish_count_;
+    record.prep_time_sum = prep_time_sum_;
+    record.revenue_cents = revenue_.cents();
+    record.elaborate_count = elaborate_count_;
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+        record.cuisine_counts[c] = cuisine_counts_[c];
+    }
+    for (int b = 0; b < PrepTimeSketch::BUCKET_COUNT; ++b) {
+        record.buckets[b] = prep_times_.bucketCount(b);
+    }
+    buffer.append(reinterpret_cast<const char*>(&record), sizeof(record));
+}
+
+bool KitchenStats::deserialize(std::string_view data, KitchenStats& stats) {
+    KitchenStatsRecord record;
+    if (data.size() != sizeof(record)) {
+        return false;
+    }
+    std::memcpy(&record, data.data(), sizeof(record));
+    if (std::memcmp(record.magic, KitchenStatsRecord::MAGIC, sizeof(record.magic)) != 0
+        || record.version != KitchenStatsRecord::CURRENT_VERSION
+        || record.byte_order != KitchenStatsRecord::BYTE_ORDER_MARK
+        || record.cuisine_type_count != static_cast<std::uint32_t>(Dish::CUISINE_TYPE_COUNT)
+        || record.bucket_count != static_cast<std::uint32_t>(PrepTimeSketch::BUCKET_COUNT)) {
+        return false;
+    }
+
+    // Every dish has one cuisine type and one sketch bucket, and at most all of them are elaborate
+    if (record.dish_count < 0 || record.prep_time_sum < 0
+        || record.elaborate_count < 0 || record.elaborate_count > record.dish_count) {
+        return false;
+    }
+    std::array<long long, Dish::CUISINE_TYPE_COUNT> cuisine_counts;
+    long long cuisine_total = 0;
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+        if (record.cuisine_counts[c] < 0 || record.cuisine_counts[c] > record.dish_count - cuisine_total) {
+            return false;
+        }
+        cuisine_counts[c] = record.cuisine_counts[c];
+        cuisine_total += cuisine_counts[c];
+    }
+    PrepTimeSketch prep_times;
+    long long bucket_total = 0;
+    for (int b = 0; b < PrepTimeSketch::BUCKET_COUNT; ++b) {
+        if (record.buckets[b] < 0 || record.buckets[b] > record.dish_count - bucket_total) {
+            return false;
+        }
+        prep_times.setBucketCount(b, record.buckets[b]);
+        bucket_total += record.buckets[b];
+    }
+    if (cuisine_total != record.dish_count || bucket_total != record.dish_count) {
+        return false;
+    }
+    stats = KitchenStats(record.dish_count, record.prep_time_sum, Price::fromCents(record.revenue_cents),
+                         record.elaborate_count, cuisine_counts, prep_times);
+    return true;
+}
+
+bool KitchenStats::operator==(const KitchenStats& other) const {
+    return dish_count_ == other.dish_count_ && prep_time_sum_ == other.prep_time_sum_
+        && revenue_ == other.revenue_ && elaborate_count_ == other.elaborate_count_
+        && cuisine_counts_ == other.cuisine_counts_ && prep_times_ == other.prep_times_;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file KitchenStats.hpp
+ * @brief This file contains the declaration of the KitchenStats class, the mergeable summary behind a kitchen report.
+ *
+ * KitchenStats holds what `Kitchen::kitchenReport` is computed from: the dish count, the cuisine counts, the
+ * preparation time sum, the elaborate count and the revenue, plus a PrepTimeSketch for preparation time percentiles.
+ * `Kitchen::stats()` returns the statistics of one kitchen without visiting its dishes. Statistics of several
+ * kitchens merge in O(Dish::CUISINE_TYPE_COUNT + PrepTimeSketch::BUCKET_COUNT), so a combined report for several
+ * stations needs no dish to be copied. `serialize` and `deserialize` carry statistics between processes as a
+ * fixed-size record in the byte order of the writer, like a KitchenSnapshot.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef KITCHEN_STATS_HPP
+#define KITCHEN_STATS_HPP
+
+#include "Dish.hpp"
+#include "PrepTimeSketch.hpp"
+#include "Price.hpp"
+#include <array>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+class KitchenStats {
+public:
+    /**
+     * Default constructor.
+     * @post Creates the statistics of an empty kitchen.
+     */
+    KitchenStats();
+
+    /**
+     * @param dish_count The number of dishes.
+     * @param prep_time_sum The sum of their preparation times in minutes.
+     * @param revenue The sum of their prices.
+     * @param elaborate_count The number of elaborate dishes.
+     * @param cuisine_counts The number of dishes per CuisineType.
+     * @param prep_times A sketch of their preparation times.
+     */
+    KitchenStats(long long dish_count, long long prep_time_sum, Price revenue, long long elaborate_count,
+                 const std::array<long long, Dish::CUISINE_TYPE_COUNT>& cuisine_counts,
+                 const PrepTimeSketch& prep_times);
+
+    long long getDishCount() const { return dish_count_; }
+    long long getPrepTimeSum() const { return prep_time_sum_; }
+    Price getRevenue() const { return revenue_; }
+    long long getElaborateCount() const { return elaborate_count_; }
+    long long getCuisineCount(Dish::CuisineType cuisine_type) const {
+        return Dish::validCuisineType(cuisine_type) == cuisine_type ? cuisine_counts_[cuisine_type] : 0;
+    }
+    const PrepTimeSketch& getPrepTimes() const { return prep_times_; }
+
+    /**
+     * @param other The statistics of another kitchen.
+     * @post Adds `other` to these statistics, which then describe the dishes of both kitchens.
+     * @return A reference to these statistics.
+     */
+    KitchenStats& merge(const KitchenStats& other);
+
+    /**
+     * @param prep_time_sum The sum of the preparation times of some dishes, in minutes.
+     * @param dish_count The number of dishes.
+     * @return Their average preparation time rounded to the nearest integer, 0 if there are no dishes. Every
+     * calculateAvgPrepTime of Kitchen, ConcurrentKitchen and KitchenStats is computed by this function.
+     */
+    static int averagePrepTime(long long prep_time_sum, long long dish_count);
+
+    /**
+     * @param elaborate_count The number of elaborate dishes.
+     * @param dish_count The number of dishes.
+     * @return The percentage of elaborate dishes rounded up to 2 decimal places, 0 if there are none. The rounding
+     * is done in integers, so exact percentages such as 7 of 50 stay exact (14.00, not 14.01). Every
+     * calculateElaboratePercentage of Kitchen, ConcurrentKitchen and KitchenStats is computed by this function.
+     */
+    static double elaboratePercentage(long long elaborate_count, long long dish_count);
+
+    /**
+     * @return The average preparation time in minutes, rounded, as `Kitchen::calculateAvgPrepTime`.
+     */
+    int calculateAvgPrepTime() const;
+
+    /**
+     * @return The percentage of elaborate dishes, rounded up to 2 decimal places, as
+     * `Kitchen::calculateElaboratePercentage`.
+     */
+    double calculateElaboratePercentage() const;
+
+    /**
+     * @param percent A percentage from 0 to 100.
+     * @return An approximate nearest-rank preparation time percentile, see PrepTimeSketch::percentile.
+     */
+    int prepTimePercentile(double percent) const;
+
+    /**
+     * @param out The output stream the report is written to.
+     * @post Writes a report in the format of `Kitchen::kitchenReport` with a single write.
+     */
+    void kitchenReport(std::ostream& out) const;
+
+    /**
+     * @param buffer The string the report described in `kitchenReport` is appended to.
+     */
+    void appendReport(std::string& buffer) const;
+
+    /**
+     * @param buffer The string the report is appended to.
+     * @param cuisine_counts The number of dishes per CuisineType.
+     * @param prep_time_sum The sum of the dishes' preparation times, in minutes.
+     * @param elaborate_count The number of elaborate dishes.
+     * @param dish_count The number of dishes.
+     * @post Appends the report in the format of `Kitchen::kitchenReport` for these counters. Every kitchen report of
+     * Kitchen, ConcurrentKitchen, KitchenView and KitchenStats is written by this function.
+     */
+    static void appendReport(std::string& buffer, const std::array<long long, Dish::CUISINE_TYPE_COUNT>& cuisine_counts,
+                             long long prep_time_sum, long long elaborate_count, long long dish_count);
+
+    /**
+     * @param buffer The string the binary form of these statistics is appended to.
+     */
+    void serialize(std::string& buffer) const;
+
+    /**
+     * @param data The binary form written by `serialize`.
+     * @param stats The statistics to replace.
+     * @return true if `data` holds exactly one record from a machine with the same byte order and cuisine types,
+     * whose counts are consistent: none negative, the cuisine counts and the sketch buckets each summing to the dish
+     * count, and the elaborate count at most the dish count. In that case `stats` is replaced; otherwise `stats` is
+     * unchanged.
+     */
+    static bool deserialize(std::string_view data, KitchenStats& stats);
+
+    bool operator==(const KitchenStats& other) const;
+    bool operator!=(const KitchenStats& other) const { return !(*this == other); }
+
+private:
+    long long dish_count_;
+    long long prep_time_sum_;
+    Price revenue_;
+    long long elaborate_count_;
+    std::array<long long, Dish::CUISINE_TYPE_COUNT> cuisine_counts_;
+    PrepTimeSketch prep_times_;
+};
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ * @file KitchenView.cpp
+ * @brief This file contains the implementation of the KitchenView class, an immutable point-in-time view of a Kitchen.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenView.hpp"
+#include <algorithm>
+#include <utility>
+
+KitchenView::KitchenView() : dish_count_(0) {
+}
+
+KitchenView::KitchenView(std::vector<Chunk> chunks, const KitchenStats& stats,
+                         std::vector<std::shared_ptr<const IngredientListPool>> arenas)
+    : chunks_(std::move(chunks)), dish_count_(0), stats_(stats), arenas_(std::move(arenas)) {
+    chunk_ends_.reserve(chunks_.size());
+    for (const Chunk& chunk : chunks_) {
+        dish_count_ += static_cast<int>(chunk->size());
+        chunk_ends_.push_back(dish_count_);
+    }
+}
+
+KitchenView KitchenView::concatenate(const std::vector<std::shared_ptr<const KitchenView>>& views) {
+    std::vector<Chunk> chunks;
+    KitchenStats stats;
+    std::vector<std::shared_ptr<const IngredientListPool>> arenas;
+    for (const std::shared_ptr<const KitchenView>& view : views) {
+        chunks.insert(chunks.end(), view->chunks_.begin(), view->chunks_.end());
+        stats.merge(view->stats_);
+        arenas.insert(arenas.end(), view->arenas_.begin(), view->arenas_.end());
+    }
+    return KitchenView(std::move(chunks), stats, std::move(arenas));
+}
+
+const Dish& KitchenView::getDishAt(int index) const {
+    std::size_t chunk = static_cast<std::size_t>(
+        std::upper_bound(chunk_ends_.begin(), chunk_ends_.end(), index) - chunk_ends_.begin());
+    int chunk_begin = (chunk > 0) ? chunk_ends_[chunk - 1] : 0;
+    return (*chunks_[chunk])[static_cast<std::size_t>(index - chunk_begin)];
+}
+
+bool KitchenView::contains(const Dish& a_dish) const {
+    for (const Chunk& chunk : chunks_) {
+        if (std::find(chunk->begin(), chunk->end(), a_dish) != chunk->end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void KitchenView::kitchenReport(std::ostream& out) const {
+    stats_.kitchenReport(out);
+}
+
+void KitchenView::dumpDishes(std::ostream& out) const {
+    std::string buffer;
+    appendDishes(buffer);
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+void KitchenView::appendDishes(std::string& buffer) const {
+    const int BYTES_PER_DISH_ESTIMATE = 128;
+    buffer.reserve(buffer.size() + static_cast<std::size_t>(dish_count_) * BYTES_PER_DISH_ESTIMATE);
+    forEachDish([&buffer](const Dish& a_dish) {
+        a_dish.appendTo(buffer);
+    });
+}
@@ -0,0 +1,128 @@
+/**
+ * @file KitchenView.hpp
+ * @brief This file contains the declaration of the KitchenView class, an immutable point-in-time view of a Kitchen.
+ *
+ * A KitchenView holds the dishes of a kitchen, in kitchen order, and its KitchenStats as they were when
+ * `Kitchen::view()` was called, and never changes afterwards: it can be read from any number of threads while the
+ * kitchen goes on taking and serving orders, though `Kitchen::view()` itself must be called on the thread that
+ * modifies the kitchen. The dishes are stored in chunks of CHUNK_SIZE shared, immutable vectors. A kitchen
+ * remembers which chunks changed since its last view and copies only those for the next one, so
+ * successive views of a large kitchen share most of their dishes and a view costs O(changed chunks * CHUNK_SIZE +
+ * chunks) rather than a copy of the whole kitchen. `concatenate` joins views of several kitchens, e.g. the shards of
+ * a ConcurrentKitchen, without copying dishes. A view shares the ingredient arenas of its kitchens, so its dishes
+ * remain valid after the kitchens are reset or destroyed.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef KITCHEN_VIEW_HPP
+#define KITCHEN_VIEW_HPP
+
+#include "Dish.hpp"
+#include "IngredientListPool.hpp"
+#include "KitchenStats.hpp"
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+class KitchenView {
+public:
+    static const int CHUNK_SHIFT = 10;
+    static const int CHUNK_SIZE = 1 << CHUNK_SHIFT;
+
+    typedef std::shared_ptr<const std::vector<Dish>> Chunk;
+
+    /**
+     * Default constructor.
+     * @post Creates the view of an empty kitchen.
+     */
+    KitchenView();
+
+    /**
+     * @param chunks The dishes of the view, in order. Chunks may hold any number of dishes.
+     * @param stats The statistics of the dishes.
+     * @param arenas The ingredient arenas of the kitchens the dishes come from, kept alive by the view so its
+     * dishes stay valid after those kitchens call `resetArena` or are destroyed.
+     */
+    KitchenView(std::vector<Chunk> chunks, const KitchenStats& stats,
+                std::vector<std::shared_ptr<const IngredientListPool>> arenas);
+
+    /**
+     * @param views Views of several kitchens.
+     * @return A view of all their dishes, in the order of `views` and then kitchen order, that shares their chunks,
+     * with their statistics merged.
+     */
+    static KitchenView concatenate(const std::vector<std::shared_ptr<const KitchenView>>& views);
+
+    /**
+     * @return The number of dishes in the view.
+     */
+    int getCurrentSize() const { return dish_count_; }
+
+    /**
+     * @return true if the view holds no dishes.
+     */
+    bool isEmpty() const { return dish_count_ == 0; }
+
+    /**
+     * @param index A position from 0 to `getCurrentSize() - 1`.
+     * @return The dish at that position.
+     */
+    const Dish& getDishAt(int index) const;
+
+    /**
+     * @param a_dish A dish.
+     * @return true if the view holds a dish equal to `a_dish`. Scans the view.
+     */
+    bool contains(const Dish& a_dish) const;
+
+    /**
+     * @return The statistics of the dishes in the view.
+     */
+    const KitchenStats& stats() const { return stats_; }
+
+    /**
+     * @return The chunks the dishes are stored in, in order.
+     */
+    const std::vector<Chunk>& chunks() const { return chunks_; }
+
+    /**
+     * @param function A callable as `void(const Dish&)`, called for every dish in order.
+     */
+    template<class Function>
+    void forEachDish(Function function) const {
+        for (const Chunk& chunk : chunks_) {
+            for (const Dish& a_dish : *chunk) {
+                function(a_dish);
+            }
+        }
+    }
+
+    /**
+     * @param out The output stream the report is written to.
+     * @post Writes the report of `Kitchen::kitchenReport` for the view.
+     */
+    void kitchenReport(std::ostream& out) const;
+
+    /**
+     * @param out The output stream the dishes are written to.
+     * @post Writes every dish in the view, in the format of `Dish::display()`, with a single write.
+     */
+    void dumpDishes(std::ostream& out) const;
+
+    /**
+     * @param buffer The string every dish in the view is appended to, in the format of `Dish::display()`.
+     */
+    void appendDishes(std::string& buffer) const;
+
+private:
+    std::vector<Chunk> chunks_;
+    std::vector<int> chunk_ends_; // running dish count at the end of each chunk
+    int dish_count_;
+    KitchenStats stats_;
+    std::vector<std::shared_ptr<const IngredientListPool>> arenas_;
+};
+
+#endif
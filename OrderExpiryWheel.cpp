@@ -0,0 +1,189 @@
+/**
+ * @file OrderExpiryWheel.cpp
+ * @brief This file contains the implementation of the OrderExpiryWheel class, the order times of a Kitchen's dishes
+ * and a hierarchical timing wheel of their expiry times.
+ *
+ * Bucket b of level L is heads_[L * BUCKETS + b]. A slot expiring at time e is placed relative to next_tick_ t at the
+ * lowest level L such that e and t agree above bit BUCKET_BITS * (L + 1), in bucket (e >> BUCKET_BITS * L) % BUCKETS.
+ * Times are compared bitwise as unsigned, so the clock may also run through negative times.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "OrderExpiryWheel.hpp"
+#include <algorithm>
+#include <limits>
+
+const int OrderExpiryWheel::NONE;
+
+OrderExpiryWheel::OrderExpiryWheel() : level0_occupied_(0), linked_count_(0), ttl_(0), next_tick_(1) {
+    heads_.fill(NONE);
+}
+
+void OrderExpiryWheel::setTtl(Time ttl) {
+    ttl_ = (ttl > 0) ? ttl : 0;
+    relinkAll();
+}
+
+void OrderExpiryWheel::reserve(int capacity) {
+    if (capacity <= static_cast<int>(order_times_.capacity())) {
+        return;
+    }
+    // Grow at least geometrically, like KitchenColumns::reserve, so many small batches stay amortized O(1)
+    std::size_t new_capacity = std::max(static_cast<std::size_t>(capacity), 2 * order_times_.capacity());
+    order_times_.reserve(new_capacity);
+    next_.reserve(new_capacity);
+    prev_.reserve(new_capacity);
+    bucket_.reserve(new_capacity);
+}
+
+void OrderExpiryWheel::clear() {
+    order_times_.clear();
+    next_.clear();
+    prev_.clear();
+    bucket_.clear();
+    heads_.fill(NONE);
+    level0_occupied_ = 0;
+    linked_count_ = 0;
+}
+
+void OrderExpiryWheel::pushBack(Time order_time) {
+    order_times_.push_back(order_time);
+    next_.push_back(NONE);
+    prev_.push_back(NONE);
+    bucket_.push_back(NONE);
+    place(size() - 1);
+}
+
+void OrderExpiryWheel::erase(int slot) {
+    int bucket = bucket_[slot];
+    if (bucket == NONE) {
+        return;
+    }
+    if (prev_[slot] != NONE) {
+        next_[prev_[slot]] = next_[slot];
+    } else {
+        heads_[bucket] = next_[slot];
+    }
+    if (next_[slot] != NONE) {
+        prev_[next_[slot]] = prev_[slot];
+    }
+    if (bucket < BUCKETS && heads_[bucket] == NONE) {
+        level0_occupied_ &= ~(std::uint64_t(1) << bucket);
+    }
+    bucket_[slot] = NONE;
+    linked_count_--;
+}
+
+void OrderExpiryWheel::moveSlot(int from_slot, int to_slot) {
+    order_times_[to_slot] = order_times_[from_slot];
+    int bucket = bucket_[from_slot];
+    bucket_[to_slot] = static_cast<std::int16_t>(bucket);
+    bucket_[from_slot] = NONE;
+    if (bucket == NONE) {
+        return;
+    }
+    next_[to_slot] = next_[from_slot];
+    prev_[to_slot] = prev_[from_slot];
+    if (prev_[to_slot] != NONE) {
+        next_[prev_[to_slot]] = to_slot;
+    } else {
+        heads_[bucket] = to_slot;
+    }
+    if (next_[to_slot] != NONE) {
+        prev_[next_[to_slot]] = to_slot;
+    }
+}
+
+void OrderExpiryWheel::truncate(int new_size) {
+    order_times_.resize(new_size);
+    next_.resize(new_size);
+    prev_.resize(new_size);
+    bucket_.resize(new_size);
+}
+
+void OrderExpiryWheel::compactMarked(const std::uint8_t* remove_mask) {
+    int write_slot = 0;
+    for (int read_slot = 0; read_slot < size(); ++read_slot) {
+        if (!remove_mask[read_slot]) {
+            order_times_[write_slot++] = order_times_[read_slot];
+        }
+    }
+    truncate(write_slot);
+    relinkAll();
+}
+
+void OrderExpiryWheel::place(int slot) {
+    if (ttl_ <= 0) {
+        return;
+    }
+    Time order_time = order_times_[slot];
+    Time expiry = (order_time > std::numeric_limits<Time>::max() - ttl_)
+        ? std::numeric_limits<Time>::max() : order_time + ttl_;
+    if (expiry < next_tick_) {
+        link(slot, OVERDUE_BUCKET);
+        return;
+    }
+
+    std::uint64_t expiry_bits = static_cast<std::uint64_t>(expiry);
+    std::uint64_t differing = expiry_bits ^ static_cast<std::uint64_t>(next_tick_);
+    int level = 0;
+    while (level < LEVELS && (differing >> (BUCKET_BITS * (level + 1))) != 0) {
+        ++level;
+    }
+    if (level == LEVELS) {
+        link(slot, OVERFLOW_BUCKET);
+    } else {
+        link(slot, level * BUCKETS + static_cast<int>((expiry_bits >> (BUCKET_BITS * level)) & (BUCKETS - 1)));
+    }
+}
+
+void OrderExpiryWheel::link(int slot, int bucket) {
+    prev_[slot] = NONE;
+    next_[slot] = heads_[bucket];
+    if (heads_[bucket] != NONE) {
+        prev_[heads_[bucket]] = slot;
+    }
+    heads_[bucket] = slot;
+    bucket_[slot] = static_cast<std::int16_t>(bucket);
+    if (bucket < BUCKETS) {
+        level0_occupied_ |= std::uint64_t(1) << bucket;
+    }
+    linked_count_++;
+}
+
+void OrderExpiryWheel::redistribute(int bucket) {
+    int slot = heads_[bucket];
+    heads_[bucket] = NONE;
+    while (slot != NONE) {
+        int next_slot = next_[slot];
+        bucket_[slot] = NONE;
+        linked_count_--;
+        place(slot);
+        slot = next_slot;
+    }
+}
+
+void OrderExpiryWheel::cascade() {
+    // Higher levels first, so their slots reach the lower buckets redistributed after them
+    std::uint64_t tick = static_cast<std::uint64_t>(next_tick_);
+    if ((tick & ((std::uint64_t(1) << (BUCKET_BITS * LEVELS)) - 1)) == 0) {
+        redistribute(OVERFLOW_BUCKET);
+    }
+    for (int level = LEVELS - 1; level > 0; --level) {
+        if ((tick & ((std::uint64_t(1) << (BUCKET_BITS * level)) - 1)) == 0) {
+            redistribute(level * BUCKETS + static_cast<int>((tick >> (BUCKET_BITS * level)) & (BUCKETS - 1)));
+        }
+    }
+}
+
+void OrderExpiryWheel::relinkAll() {
+    heads_.fill(NONE);
+    level0_occupied_ = 0;
+    linked_count_ = 0;
+    for (int slot = 0; slot < size(); ++slot) {
+        bucket_[slot] = NONE;
+        place(slot);
+    }
+}
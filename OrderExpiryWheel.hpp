@@ -0,0 +1,215 @@
+/**
+ * @file OrderExpiryWheel.hpp
+ * @brief This file contains the declaration of the OrderExpiryWheel class, the order times of a Kitchen's dishes and
+ * a hierarchical timing wheel of their expiry times.
+ *
+ * Like KitchenColumns, OrderExpiryWheel is kept slot for slot with a Kitchen's dishes: it stores the time each dish
+ * was ordered, and, when a time to live (TTL) is set, links each slot into the wheel bucket of its expiry time,
+ * order time + TTL. Times are integers in a unit chosen by the caller, e.g. seconds; one unit is one tick.
+ *
+ * The wheel has LEVELS levels of BUCKETS buckets. Level 0 holds the slots expiring within the current run of BUCKETS
+ * ticks, one bucket per tick; level L holds those expiring within the current run of BUCKETS^(L+1) ticks, one bucket
+ * per BUCKETS^L ticks; slots beyond the last level wait in an overflow list. When the clock enters a new run of a
+ * level, the matching bucket of the level above is redistributed to the levels below, so a slot is moved at most
+ * LEVELS times over its life. Buckets are intrusive doubly-linked lists over slots, so linking, unlinking and moving a
+ * slot are O(1), and `advance` costs O(expired slots + redistributed slots) plus a constant per BUCKETS ticks
+ * skipped, using a bitmap of the non-empty level 0 buckets. Slots that are already past their expiry time when
+ * linked, which only happens when the TTL is shortened, wait in an overdue list for the next `advance`.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef ORDER_EXPIRY_WHEEL_HPP
+#define ORDER_EXPIRY_WHEEL_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+class OrderExpiryWheel {
+public:
+    static const int BUCKET_BITS = 6;
+    static const int BUCKETS = 1 << BUCKET_BITS;
+    static const int LEVELS = 5;
+
+    typedef std::int64_t Time;
+
+    /**
+     * Default constructor.
+     * @post Creates an empty wheel at time 0, with no TTL, so nothing expires.
+     */
+    OrderExpiryWheel();
+
+    /**
+     * @return The number of slots.
+     */
+    int size() const { return static_cast<int>(order_times_.size()); }
+
+    /**
+     * @return The current time: the last time passed to `advance`, 0 if there was none.
+     */
+    Time currentTime() const { return next_tick_ - 1; }
+
+    /**
+     * @return The time to live, 0 if dishes never expire.
+     */
+    Time ttl() const { return ttl_; }
+
+    /**
+     * @param ttl The time to live; 0 or less means dishes never expire.
+     * @post Relinks every slot by its new expiry time. Slots whose expiry time has already passed expire at the
+     * next `advance`.
+     */
+    void setTtl(Time ttl);
+
+    /**
+     * @param slot A slot from 0 to `size() - 1`.
+     * @return The time the dish in the slot was ordered.
+     */
+    Time orderTime(int slot) const { return order_times_[slot]; }
+
+    /**
+     * @param capacity The number of slots to reserve memory for. If the wheel must grow, it grows to at least twice
+     * its current capacity.
+     */
+    void reserve(int capacity);
+
+    /**
+     * @post Removes all slots. The current time and the TTL are kept.
+     */
+    void clear();
+
+    /**
+     * @param order_time The time the dish was ordered.
+     * @post Appends a slot and links it by its expiry time.
+     */
+    void pushBack(Time order_time);
+
+    /**
+     * @param slot A slot whose dish is being removed.
+     * @post Unlinks the slot. It must then be overwritten by `moveSlot` or dropped by `truncate`.
+     */
+    void erase(int slot);
+
+    /**
+     * @param from_slot The slot a dish is moved from. It is left unlinked.
+     * @param to_slot The slot the dish is moved to, which must be unlinked, e.g. by `erase`.
+     */
+    void moveSlot(int from_slot, int to_slot);
+
+    /**
+     * @param new_size The number of slots to keep. The slots dropped must be unlinked.
+     */
+    void truncate(int new_size);
+
+    /**
+     * @param remove_mask One byte per slot, nonzero for the slots to be removed.
+     * @post Removes the marked slots, keeping the others in order, and relinks the rest. O(size()).
+     */
+    void compactMarked(const std::uint8_t* remove_mask);
+
+    /**
+     * @param now The time to advance to. Earlier times are ignored.
+     * @param expire_slot A callable as `void(int slot)`, called for each slot whose expiry time is at most `now`,
+     * in expiry order. It must remove the slot's dish, which `erase`s the slot; it may move other slots.
+     * @return The number of slots expired.
+     */
+    template<class ExpireSlot>
+    int advance(Time now, ExpireSlot expire_slot);
+
+private:
+    static const int NONE = -1;
+    static const int OVERFLOW_BUCKET = LEVELS * BUCKETS;
+    static const int OVERDUE_BUCKET = OVERFLOW_BUCKET + 1;  // expired before the current time, e.g. by a new TTL
+    static const int BUCKET_COUNT = OVERDUE_BUCKET + 1;
+
+    std::vector<Time> order_times_;
+    std::vector<int> next_;              // next slot in the same bucket, NONE at the end
+    std::vector<int> prev_;              // previous slot in the same bucket, NONE at the head
+    std::vector<std::int16_t> bucket_;   // bucket the slot is linked into, NONE if unlinked
+    std::array<int, BUCKET_COUNT> heads_;
+    std::uint64_t level0_occupied_;      // bit b set if level 0 bucket b is not empty
+    int linked_count_;
+    Time ttl_;
+    Time next_tick_;                     // every expiry time before this has been processed
+
+    /**
+     * @param slot An unlinked slot.
+     * @post Links the slot into the bucket of its expiry time, relative to next_tick_, if there is a TTL.
+     */
+    void place(int slot);
+
+    /**
+     * @param slot A slot.
+     * @param bucket A bucket.
+     * @post Links the unlinked slot at the head of the bucket.
+     */
+    void link(int slot, int bucket);
+
+    /**
+     * @param bucket A bucket.
+     * @post Relinks every slot of the bucket, relative to next_tick_.
+     */
+    void redistribute(int bucket);
+
+    /**
+     * @post Redistributes the buckets of the levels above 0 whose run starts at next_tick_.
+     */
+    void cascade();
+
+    /**
+     * @post Relinks every slot, relative to next_tick_.
+     */
+    void relinkAll();
+};
+
+template<class ExpireSlot>
+int OrderExpiryWheel::advance(Time now, ExpireSlot expire_slot)
+{
+    int expired = 0;
+    if (now < currentTime())
+        return expired;
+    while (heads_[OVERDUE_BUCKET] != NONE)
+    {
+        expire_slot(heads_[OVERDUE_BUCKET]);
+        ++expired;
+    }
+    while (next_tick_ <= now)
+    {
+        if (linked_count_ == 0)
+        {
+            next_tick_ = now + 1;
+            break;
+        }
+        int first_bucket = static_cast<int>(static_cast<std::uint64_t>(next_tick_) & (BUCKETS - 1));
+        if (first_bucket == 0)
+            cascade();
+
+        // Jump to the next non-empty level 0 bucket of this run, or to the start of the next run
+        Time run_begin = next_tick_ - first_bucket;
+        std::uint64_t pending = level0_occupied_ >> first_bucket << first_bucket;
+        if (pending == 0)
+        {
+            next_tick_ = (run_begin + BUCKETS <= now) ? run_begin + BUCKETS : now + 1;
+            continue;
+        }
+        int bucket = __builtin_ctzll(pending);
+        Time due = run_begin + bucket;
+        if (due > now)
+        {
+            next_tick_ = now + 1;
+            break;
+        }
+        next_tick_ = due;
+        while (heads_[bucket] != NONE)
+        {
+            expire_slot(heads_[bucket]);
+            ++expired;
+        }
+        next_tick_ = due + 1;
+    }
+    return expired;
+}
+
+#endif
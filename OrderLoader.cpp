@@ -0,0 +1,707 @@
+/**
+ * @file OrderLoader.cpp
+ * @brief This file contains the implementation of the OrderLoader class, a streaming reader of order files into a
+ * Kitchen.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "OrderLoader.hpp"
+#include <algorithm>
+#include <charconv>
+#include <climits>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace {
+
+bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+std::string_view trim(std::string_view text) {
+    while (!text.empty() && isBlank(text.front())) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && isBlank(text.back())) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+bool parseInt(std::string_view text, int& value) {
+    text = trim(text);
+    if (!text.empty() && text.front() == '+') {
+        text.remove_prefix(1);
+    }
+    std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), value);
+    return !text.empty() && result.ec == std::errc() && result.ptr == text.data() + text.size();
+}
+
+// Parses a decimal number with an optional exponent, such as "12", "-3.5", "12.505" or "1.25e1", to a count of
+// 10^-scale units, e.g. cents for scale 2, rounding halfway cases away from zero. `exact` is set to false if nonzero
+// digits were rounded off. Fails on out-of-range values.
+bool parseScaled(std::string_view text, int scale, long long& value, bool& exact) {
+    const int MAX_SIGNIFICANT_DIGITS = 18;  // 10^18 still fits in a long long
+    const int MAX_EXPONENT = 100000;
+    text = trim(text);
+    bool negative = false;
+    if (!text.empty() && (text.front() == '-' || text.front() == '+')) {
+        negative = text.front() == '-';
+        text.remove_prefix(1);
+    }
+
+    // The digits become mantissa * 10^exponent; digits beyond MAX_SIGNIFICANT_DIGITS are only checked for zero
+    long long mantissa = 0;
+    int significant_digits = 0;
+    long long exponent = 0;
+    bool dropped_nonzero = false;
+    std::size_t digit_count = 0;
+    std::size_t i = 0;
+    bool in_fraction = false;
+    for (; i < text.size(); ++i) {
+        char c = text[i];
+        if (c == '.' && !in_fraction) {
+            in_fraction = true;
+            continue;
+        }
+        if (c < '0' || c > '9') {
+            break;
+        }
+        digit_count++;
+        if (significant_digits < MAX_SIGNIFICANT_DIGITS) {
+            mantissa = mantissa * 10 + (c - '0');
+            significant_digits += (mantissa != 0);
+            exponent -= in_fraction;
+        } else {
+            dropped_nonzero |= (c != '0');
+            exponent += !in_fraction;
+        }
+    }
+    if (digit_count == 0) {
+        return false;
+    }
+    if (i < text.size() && (text[i] == 'e' || text[i] == 'E')) {
+        ++i;
+        bool negative_exponent = false;
+        if (i < text.size() && (text[i] == '-' || text[i] == '+')) {
+            negative_exponent = text[i] == '-';
+            ++i;
+        }
+        long long written_exponent = 0;
+        std::size_t exponent_start = i;
+        for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; ++i) {
+            written_exponent = std::min<long long>(MAX_EXPONENT, written_exponent * 10 + (text[i] - '0'));
+        }
+        if (i == exponent_start) {
+            return false;
+        }
+        exponent += negative_exponent ? -written_exponent : written_exponent;
+    }
+    if (i != text.size()) {
+        return false;
+    }
+
+    long long shift = exponent + scale;
+    long long result = mantissa;
+    exact = !dropped_nonzero;
+    if (mantissa == 0) {
+        result = 0;
+    } else if (shift >= 0) {
+        for (long long s = 0; s < shift; ++s) {
+            if (result > LLONG_MAX / 10) {
+                return false;
+            }
+            result *= 10;
+        }
+    } else if (shift < -MAX_SIGNIFICANT_DIGITS) {
+        result = 0;  // below half a unit, since mantissa < 10^18
+        exact = false;
+    } else {
+        long long divisor = 1;
+        for (long long s = 0; s < -shift; ++s) {
+            divisor *= 10;
+        }
+        long long remainder = mantissa % divisor;
+        result = mantissa / divisor;
+        if (remainder * 2 >= divisor) {
+            result++;  // halfway cases round away from zero, as the sign is applied afterwards
+        }
+        exact = exact && remainder == 0;
+    }
+    value = negative ? -result : result;
+    return true;
+}
+
+// Parses a decimal amount such as "12", "-3.5", "12.505" or "1.25e1" to cents, rounding halfway cases away from zero
+bool parsePrice(std::string_view text, Price& price) {
+    long long cents;
+    bool exact;
+    if (!parseScaled(text, 2, cents, exact)) {
+        return false;
+    }
+    price = Price::fromCents(cents);
+    return true;
+}
+
+// Parses a JSON number that must be a whole int, such as "25", "25.0" or "2.5e1"
+bool parseJsonInt(std::string_view text, int& value) {
+    long long whole;
+    bool exact;
+    if (!parseScaled(text, 0, whole, exact) || !exact || whole < INT_MIN || whole > INT_MAX) {
+        return false;
+    }
+    value = static_cast<int>(whole);
+    return true;
+}
+
+bool parseCuisine(std::string_view text, Dish::CuisineType& cuisine_type) {
+    text = trim(text);
+    if (text.empty()) {
+        cuisine_type = Dish::OTHER;
+        return true;
+    }
+    return Dish::parseCuisineType(text, cuisine_type);
+}
+
+// Parses rows into dishes. Fields are views into the row, or into scratch strings when they had to be unescaped.
+// One RowParser is used by one thread at a time. Ingredient lists are interned in the given pool, by default the global one.
+class RowParser {
+public:
+    RowParser() = default;
+    explicit RowParser(IngredientListPool& pool) : pool_(&pool) {}
+
+    bool parseCsv(std::string_view line, Dish& a_dish);
+    bool parseJson(std::string_view line, Dish& a_dish);
+
+private:
+    std::deque<std::string> scratch_;  // deque, so views of earlier strings survive adding more
+    std::size_t scratch_used_ = 0;
+    std::vector<std::string_view> ingredients_;
+    IngredientListPool* pool_ = &IngredientListPool::global();
+
+    std::string& nextScratch();
+    void startRow();
+
+    // CSV
+    bool csvField(std::string_view line, std::size_t& pos, std::string_view& field);
+    void splitIngredients(std::string_view field);
+
+    // JSON
+    static void skipBlanks(std::string_view line, std::size_t& pos);
+    bool jsonString(std::string_view line, std::size_t& pos, std::string_view& value);
+    static bool jsonNumber(std::string_view line, std::size_t& pos, std::string_view& token);
+    bool jsonStringArray(std::string_view line, std::size_t& pos);
+    bool skipJsonValue(std::string_view line, std::size_t& pos);
+};
+
+std::string& RowParser::nextScratch() {
+    if (scratch_used_ == scratch_.size()) {
+        scratch_.emplace_back();
+    }
+    std::string& scratch = scratch_[scratch_used_++];
+    scratch.clear();
+    return scratch;
+}
+
+void RowParser::startRow() {
+    scratch_used_ = 0;
+    ingredients_.clear();
+}
+
+bool RowParser::parseCsv(std::string_view line, Dish& a_dish) {
+    startRow();
+    std::string_view fields[5];
+    std::size_t pos = 0;
+    for (int i = 0; i < 5; ++i) {
+        if (!csvField(line, pos, fields[i])) {
+            return false;
+        }
+        bool last = (i == 4);
+        if (last != (pos >= line.size())) {
+            return false;  // too few or too many fields
+        }
+        pos++;  // skip the comma
+    }
+
+    int prep_time;
+    Price price;
+    Dish::CuisineType cuisine_type;
+    if (!parseInt(fields[2], prep_time) || !parsePrice(fields[3], price) || !parseCuisine(fields[4], cuisine_type)) {
+        return false;
+    }
+    std::string_view name = trim(fields[0]);
+    if (!Dish::isValidName(name)) {
+        return false;  // counted as malformed rather than added as UNKNOWN
+    }
+    splitIngredients(fields[1]);
+    a_dish = Dish::fromFields(name, ingredients_.data(), ingredients_.size(), prep_time, price, cuisine_type,
+                              *pool_);
+    return true;
+}
+
+bool RowParser::csvField(std::string_view line, std::size_t& pos, std::string_view& field) {
+    std::size_t start = pos;
+    while (start < line.size() && (line[start] == ' ' || line[start] == '\t')) {
+        start++;
+    }
+    if (start >= line.size() || line[start] != '"') {
+        std::size_t end = line.find(',', pos);
+        if (end == std::string_view::npos) {
+            end = line.size();
+        }
+        field = line.substr(pos, end - pos);
+        pos = end;
+        return true;
+    }
+
+    // Quoted field: copy only if it contains "" escapes
+    std::size_t begin = start + 1;
+    std::size_t close = line.find('"', begin);
+    std::string* unescaped = nullptr;
+    while (close != std::string_view::npos && close + 1 < line.size() && line[close + 1] == '"') {
+        if (unescaped == nullptr) {
+            unescaped = &nextScratch();
+        }
+        unescaped->append(line.data() + begin, close + 1 - begin);
+        begin = close + 2;
+        close = line.find('"', begin);
+    }
+    if (close == std::string_view::npos) {
+        return false;
+    }
+    if (unescaped != nullptr) {
+        unescaped->append(line.data() + begin, close - begin);
+        field = *unescaped;
+    } else {
+        field = line.substr(begin, close - begin);
+    }
+
+    pos = close + 1;
+    while (pos < line.size() && (line[pos] == ' ' || line[pos] == '\t' || line[pos] == '\r')) {
+        pos++;
+    }
+    return pos >= line.size() || line[pos] == ',';
+}
+
+void RowParser::splitIngredients(std::string_view field) {
+    while (!field.empty()) {
+        std::size_t end = field.find(';');
+        std::string_view ingredient = trim(field.substr(0, end));
+        if (!ingredient.empty()) {
+            ingredients_.push_back(ingredient);
+        }
+        if (end == std::string_view::npos) {
+            break;
+        }
+        field.remove_prefix(end + 1);
+    }
+}
+
+bool RowParser::parseJson(std::string_view line, Dish& a_dish) {
+    startRow();
+    std::string_view name = "UNKNOWN";
+    int prep_time = 0;
+    Price price;
+    Dish::CuisineType cuisine_type = Dish::OTHER;
+
+    std::size_t pos = 0;
+    skipBlanks(line, pos);
+    if (pos >= line.size() || line[pos] != '{') {
+        return false;
+    }
+    pos++;
+    skipBlanks(line, pos);
+    if (pos < line.size() && line[pos] == '}') {
+        pos++;
+    } else {
+        for (;;) {
+            std::string_view key;
+            skipBlanks(line, pos);
+            if (!jsonString(line, pos, key)) {
+                return false;
+            }
+            skipBlanks(line, pos);
+            if (pos >= line.size() || line[pos] != ':') {
+                return false;
+            }
+            pos++;
+            skipBlanks(line, pos);
+
+            std::string_view value;
+            if (key == "name") {
+                if (!jsonString(line, pos, name)) {
+                    return false;
+                }
+            } else if (key == "ingredients") {
+                if (!jsonStringArray(line, pos)) {
+                    return false;
+                }
+            } else if (key == "prep_time") {
+                if (!jsonNumber(line, pos, value) || !parseJsonInt(value, prep_time)) {
+                    return false;
+                }
+            } else if (key == "price") {
+                if (!jsonNumber(line, pos, value) || !parsePrice(value, price)) {
+                    return false;
+                }
+            } else if (key == "cuisine_type") {
+                if (!jsonString(line, pos, value) || !Dish::parseCuisineType(value, cuisine_type)) {
+                    return false;
+                }
+            } else if (!skipJsonValue(line, pos)) {
+                return false;
+            }
+
+            skipBlanks(line, pos);
+            if (pos < line.size() && line[pos] == ',') {
+                pos++;
+            } else if (pos < line.size() && line[pos] == '}') {
+                pos++;
+                break;
+            } else {
+                return false;
+            }
+        }
+    }
+    skipBlanks(line, pos);
+    if (pos != line.size() || !Dish::isValidName(name)) {
+        return false;
+    }
+
+    a_dish = Dish::fromFields(name, ingredients_.data(), ingredients_.size(), prep_time, price, cuisine_type, *pool_);
+    return true;
+}
+
+void RowParser::skipBlanks(std::string_view line, std::size_t& pos) {
+    while (pos < line.size() && isBlank(line[pos])) {
+        pos++;
+    }
+}
+
+// Appends the UTF-8 encoding of a code point
+void appendUtf8(std::string& out, unsigned long code_point) {
+    if (code_point < 0x80) {
+        out += static_cast<char>(code_point);
+    } else if (code_point < 0x800) {
+        out += static_cast<char>(0xC0 | (code_point >> 6));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    } else if (code_point < 0x10000) {
+        out += static_cast<char>(0xE0 | (code_point >> 12));
+        out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (code_point >> 18));
+        out += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+}
+
+bool parseHex4(std::string_view line, std::size_t pos, unsigned long& value) {
+    if (pos + 4 > line.size()) {
+        return false;
+    }
+    std::from_chars_result result = std::from_chars(line.data() + pos, line.data() + pos + 4, value, 16);
+    return result.ec == std::errc() && result.ptr == line.data() + pos + 4;
+}
+
+bool RowParser::jsonString(std::string_view line, std::size_t& pos, std::string_view& value) {
+    if (pos >= line.size() || line[pos] != '"') {
+        return false;
+    }
+    std::size_t begin = pos + 1;
+    std::size_t end = line.find_first_of("\"\\", begin);
+    if (end == std::string_view::npos) {
+        return false;
+    }
+    if (line[end] == '"') {
+        value = line.substr(begin, end - begin);
+        pos = end + 1;
+        return true;
+    }
+
+    // The string has escapes, so it is decoded into a scratch string
+    std::string& decoded = nextScratch();
+    decoded.append(line.data() + begin, end - begin);
+    std::size_t i = end;
+    while (i < line.size() && line[i] != '"') {
+        if (line[i] != '\\') {
+            decoded += line[i++];
+            continue;
+        }
+        if (++i >= line.size()) {
+            return false;
+        }
+        char escape = line[i++];
+        switch (escape) {
+            case '"': decoded += '"'; break;
+            case '\\': decoded += '\\'; break;
+            case '/': decoded += '/'; break;
+            case 'b': decoded += '\b'; break;
+            case 'f': decoded += '\f'; break;
+            case 'n': decoded += '\n'; break;
+            case 'r': decoded += '\r'; break;
+            case 't': decoded += '\t'; break;
+            case 'u': {
+                unsigned long code_point;
+                if (!parseHex4(line, i, code_point)) {
+                    return false;
+                }
+                i += 4;
+                unsigned long low;
+                if (code_point >= 0xD800 && code_point < 0xDC00 && i + 1 < line.size() && line[i] == '\\' &&
+                    line[i + 1] == 'u' && parseHex4(line, i + 2, low) && low >= 0xDC00 && low < 0xE000) {
+                    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+                    i += 6;
+                }
+                appendUtf8(decoded, code_point);
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    if (i >= line.size()) {
+        return false;
+    }
+    value = decoded;
+    pos = i + 1;
+    return true;
+}
+
+bool RowParser::jsonNumber(std::string_view line, std::size_t& pos, std::string_view& token) {
+    std::size_t end = pos;
+    while (end < line.size() && (line[end] == '-' || line[end] == '+' || line[end] == '.' || line[end] == 'e' ||
+                                 line[end] == 'E' || (line[end] >= '0' && line[end] <= '9'))) {
+        end++;
+    }
+    token = line.substr(pos, end - pos);
+    pos = end;
+    return !token.empty();
+}
+
+bool RowParser::jsonStringArray(std::string_view line, std::size_t& pos) {
+    if (pos >= line.size() || line[pos] != '[') {
+        return false;
+    }
+    pos++;
+    skipBlanks(line, pos);
+    if (pos < line.size() && line[pos] == ']') {
+        pos++;
+        return true;
+    }
+    for (;;) {
+        std::string_view ingredient;
+        skipBlanks(line, pos);
+        if (!jsonString(line, pos, ingredient)) {
+            return false;
+        }
+        ingredients_.push_back(ingredient);
+        skipBlanks(line, pos);
+        if (pos < line.size() && line[pos] == ',') {
+            pos++;
+        } else if (pos < line.size() && line[pos] == ']') {
+            pos++;
+            return true;
+        } else {
+            return false;
+        }
+    }
+}
+
+bool RowParser::skipJsonValue(std::string_view line, std::size_t& pos) {
+    // Skips any value, tracking nesting and strings, without interpreting it
+    int depth = 0;
+    std::string_view ignored;
+    do {
+        skipBlanks(line, pos);
+        if (pos >= line.size()) {
+            return false;
+        }
+        char c = line[pos];
+        if (c == '"') {
+            if (!jsonString(line, pos, ignored)) {
+                return false;
+            }
+        } else if (c == '{' || c == '[') {
+            depth++;
+            pos++;
+        } else if (c == '}' || c == ']') {
+            if (depth == 0) {
+                return false;
+            }
+            depth--;
+            pos++;
+        } else if (c == ',' || c == ':') {
+            if (depth == 0) {
+                return false;
+            }
+            pos++;
+        } else {
+            std::size_t end = pos;
+            while (end < line.size() && !isBlank(line[end]) && line[end] != ',' && line[end] != '}' &&
+                   line[end] != ']') {
+                end++;
+            }
+            if (end == pos) {
+                return false;
+            }
+            pos = end;
+        }
+    } while (depth > 0);
+    return true;
+}
+
+// What one parsing pass over part of a chunk produced
+struct ParsedRows {
+    std::vector<Dish> dishes;
+    long long rows = 0;
+    long long malformed = 0;
+};
+
+void parseLines(std::string_view text, OrderLoader::Format format, RowParser& parser, ParsedRows& parsed) {
+    parsed.dishes.clear();
+    parsed.rows = 0;
+    parsed.malformed = 0;
+    Dish a_dish;
+    while (!text.empty()) {
+        std::size_t end = text.find('\n');
+        std::string_view line = text.substr(0, end);
+        text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (trim(line).empty()) {
+            continue;
+        }
+
+        parsed.rows++;
+        bool parsed_ok = (format == OrderLoader::CSV) ? parser.parseCsv(line, a_dish) : parser.parseJson(line, a_dish);
+        if (parsed_ok) {
+            parsed.dishes.push_back(a_dish);
+        } else {
+            parsed.malformed++;
+        }
+    }
+}
+
+} // namespace
+
+OrderLoader::OrderLoader() : options_() {
+}
+
+OrderLoader::OrderLoader(const Options& options) : options_(options) {
+    if (options_.chunk_bytes == 0) {
+        options_.chunk_bytes = Options().chunk_bytes;
+    }
+    if (options_.parse_threads < 1) {
+        options_.parse_threads = 1;
+    }
+}
+
+OrderLoader::Stats OrderLoader::load(std::istream& in, Kitchen& kitchen) const {
+    // Chunks smaller than this are parsed on the calling thread even if parse_threads > 1
+    const std::size_t MIN_BYTES_PER_THREAD = 64 * 1024;
+
+    Stats stats;
+    // Dishes are built in the kitchen's arena, so the kitchen finds their lists there when it adds them
+    std::vector<RowParser> parsers(options_.parse_threads, RowParser(kitchen.getIngredientArena()));
+    std::vector<ParsedRows> parts(options_.parse_threads);
+    std::string buffer;
+    bool at_start = true;
+
+    while (in) {
+        std::size_t carried = buffer.size();
+        buffer.resize(carried + options_.chunk_bytes);
+        in.read(&buffer[carried], static_cast<std::streamsize>(options_.chunk_bytes));
+        buffer.resize(carried + static_cast<std::size_t>(in.gcount()));
+
+        // Parse up to the last complete line; the rest waits for the next chunk
+        std::size_t parse_end = buffer.size();
+        if (in) {
+            std::size_t last_break = buffer.rfind('\n');
+            if (last_break == std::string::npos) {
+                continue;
+            }
+            parse_end = last_break + 1;
+        }
+        std::string_view text(buffer.data(), parse_end);
+
+        if (at_start) {
+            at_start = false;
+            if (options_.format == CSV && text.substr(0, 5) == "name,") {
+                std::size_t header_end = text.find('\n');
+                text.remove_prefix(header_end == std::string_view::npos ? text.size() : header_end + 1);
+            }
+        }
+
+        // Split the text at line breaks into one part per thread
+        std::size_t part_count = 1;
+        if (options_.parse_threads > 1) {
+            part_count = std::min<std::size_t>(options_.parse_threads, text.size() / MIN_BYTES_PER_THREAD + 1);
+        }
+        std::vector<std::string_view> pieces;
+        std::string_view rest = text;
+        for (std::size_t p = 1; p < part_count && !rest.empty(); ++p) {
+            std::size_t cut = rest.find('\n', std::min(rest.size() - 1, text.size() / part_count));
+            cut = (cut == std::string_view::npos) ? rest.size() : cut + 1;
+            pieces.push_back(rest.substr(0, cut));
+            rest.remove_prefix(cut);
+        }
+        pieces.push_back(rest);
+
+        if (pieces.size() == 1) {
+            parseLines(pieces[0], options_.format, parsers[0], parts[0]);
+        } else {
+            std::vector<std::thread> workers;
+            for (std::size_t p = 1; p < pieces.size(); ++p) {
+                workers.emplace_back(parseLines, pieces[p], options_.format, std::ref(parsers[p]), std::ref(parts[p]));
+            }
+            parseLines(pieces[0], options_.format, parsers[0], parts[0]);
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+        }
+
+        for (std::size_t p = 0; p < pieces.size(); ++p) {
+            ParsedRows& part = parts[p];
+            std::vector<bool> accepted = kitchen.newOrders(std::make_move_iterator(part.dishes.begin()),
+                                                           std::make_move_iterator(part.dishes.end()));
+            long long added = 0;
+            for (bool was_added : accepted) {
+                added += was_added;
+            }
+            stats.rows += part.rows;
+            stats.malformed += part.malformed;
+            stats.added += added;
+            stats.refused += static_cast<long long>(accepted.size()) - added;
+        }
+        buffer.erase(0, parse_end);
+    }
+    return stats;
+}
+
+bool OrderLoader::loadFile(const std::string& path, Kitchen& kitchen, Stats& stats) const {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    stats = load(in, kitchen);
+    return !in.bad();
+}
+
+bool OrderLoader::parseCsvRow(std::string_view line, Dish& a_dish) {
+    RowParser parser;
+    return parser.parseCsv(line, a_dish);
+}
+
+bool OrderLoader::parseJsonRow(std::string_view line, Dish& a_dish) {
+    RowParser parser;
+    return parser.parseJson(line, a_dish);
+}
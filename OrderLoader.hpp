@@ -0,0 +1,106 @@
+/**
+ * @file OrderLoader.hpp
+ * @brief This file contains the declaration of the OrderLoader class, a streaming reader of order files into a
+ * Kitchen.
+ *
+ * The loader reads CSV or JSON-lines input in fixed-size chunks. Each chunk is cut at its last complete line, its
+ * rows are parsed into Dish objects and the whole batch is added with Kitchen::newOrders, so memory stays bounded
+ * by the chunk size however long the input is. Fields are parsed as views into the chunk: cuisine names go straight
+ * to Dish::CuisineType, prices straight to integer cents, and names and ingredients are interned from the views by
+ * Dish::fromFields. Only fields containing escapes are copied. Optionally the rows of a chunk are parsed by several
+ * threads; the dishes are still added in file order.
+ *
+ * CSV rows are `name,ingredients,prep_time,price,cuisine_type`, with the ingredients separated by ';'. Fields may
+ * be double-quoted, with "" standing for a quote. A first line starting with `name,` is taken as a header.
+ * JSON lines are objects such as
+ *     {"name": "Pad Thai", "ingredients": ["Noodles", "Peanuts"], "prep_time": 25, "price": 12.5, "cuisine_type": "OTHER"}
+ * Missing keys keep the Dish defaults and unknown keys are ignored. Prices, in either format, are decimals that may
+ * have an exponent, e.g. 1.25e1, and are rounded to the nearest cent; JSON preparation times may be written the same
+ * way but must be whole numbers. A row whose name is not valid for a Dish (letters and spaces only, see
+ * Dish::isValidName) is malformed, rather than loaded as "UNKNOWN".
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef ORDER_LOADER_HPP
+#define ORDER_LOADER_HPP
+
+#include "Dish.hpp"
+#include "Kitchen.hpp"
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+class OrderLoader {
+public:
+    enum Format { CSV, JSON_LINES };
+
+    /**
+     * How the input is read.
+     */
+    struct Options {
+        Format format;
+        std::size_t chunk_bytes;  // bytes read per chunk; a longer line grows the chunk to hold it
+        int parse_threads;        // threads parsing each chunk, 1 to parse on the calling thread
+
+        Options() : format(CSV), chunk_bytes(1 << 20), parse_threads(1) {}
+    };
+
+    /**
+     * Counts of what happened to the rows of the input.
+     */
+    struct Stats {
+        long long rows = 0;       // non-empty lines, excluding a CSV header
+        long long added = 0;      // dishes the kitchen accepted
+        long long refused = 0;    // well-formed dishes the kitchen refused (duplicate or full)
+        long long malformed = 0;  // lines that could not be parsed, skipped
+    };
+
+    /**
+     * Default constructor.
+     * Reads CSV in 1 MiB chunks on the calling thread.
+     */
+    OrderLoader();
+
+    /**
+     * Parameterized constructor.
+     * @param options How the input is read.
+     */
+    explicit OrderLoader(const Options& options);
+
+    /**
+     * @param in A reference to the stream the orders are read from, until its end.
+     * @param kitchen A reference to the kitchen the orders are added to, one batch per chunk.
+     * @return What happened to the rows.
+     */
+    Stats load(std::istream& in, Kitchen& kitchen) const;
+
+    /**
+     * @param path The path of the order file.
+     * @param kitchen A reference to the kitchen the orders are added to.
+     * @param stats A reference set to what happened to the rows.
+     * @return True if the file could be opened and read, false otherwise.
+     */
+    bool loadFile(const std::string& path, Kitchen& kitchen, Stats& stats) const;
+
+    /**
+     * @param line One CSV row, without its line break.
+     * @param a_dish A reference set to the parsed dish.
+     * @return True if the row was well formed.
+     */
+    static bool parseCsvRow(std::string_view line, Dish& a_dish);
+
+    /**
+     * @param line One JSON object, without its line break.
+     * @param a_dish A reference set to the parsed dish.
+     * @return True if the row was well formed.
+     */
+    static bool parseJsonRow(std::string_view line, Dish& a_dish);
+
+private:
+    Options options_;
+};
+
+#endif // ORDER_LOADER_HPP
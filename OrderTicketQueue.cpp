@@ -0,0 +1,120 @@
+/**
+ * @file OrderTicketQueue.cpp
+ * @brief This file contains the implementation of the OrderTicketQueue class, a bounded lock-free queue of orders for a Kitchen.
+ *
+ * A cell whose sequence equals the enqueue position is free for that position; a producer claims it by advancing
+ * the enqueue position, writes the dish and publishes it by setting the sequence to position + 1. The consumer reads
+ * the dish at that sequence and frees the cell for the next lap by setting it to position + capacity.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "OrderTicketQueue.hpp"
+#include <iterator>
+#include <utility>
+
+OrderTicketQueue::OrderTicketQueue(int capacity)
+    : enqueue_pos_(0), dequeue_pos_(0), rejected_full_(0), high_water_mark_(0), orders_added_(0), orders_refused_(0) {
+    std::size_t rounded = 2;
+    while (rounded < static_cast<std::size_t>(capacity)) {
+        rounded <<= 1;
+    }
+    cells_.reset(new Cell[rounded]);
+    mask_ = rounded - 1;
+    for (std::size_t i = 0; i < rounded; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool OrderTicketQueue::tryPush(Dish&& a_dish) {
+    std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+        if (difference == 0) {
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            rejected_full_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->dish = std::move(a_dish);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    // The depth just after this push, so the high-water mark also sees bursts between two drains
+    std::size_t dequeued = dequeue_pos_.load(std::memory_order_relaxed);
+    int current_depth = pos + 1 > dequeued ? static_cast<int>(pos + 1 - dequeued) : 0;
+    int high_water_mark = high_water_mark_.load(std::memory_order_relaxed);
+    while (current_depth > high_water_mark
+           && !high_water_mark_.compare_exchange_weak(high_water_mark, current_depth, std::memory_order_relaxed)) {
+    }
+    return true;
+}
+
+bool OrderTicketQueue::tryPop(Dish& a_dish) {
+    std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Cell& cell = cells_[pos & mask_];
+    std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+    if (static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1) < 0) {
+        return false;
+    }
+
+    a_dish = std::move(cell.dish);
+    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+    dequeue_pos_.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+int OrderTicketQueue::drainInto(Kitchen& kitchen, int max_batch) {
+    drain_batch_.resize(max_batch > 0 ? max_batch : 0);
+    int drained = 0;
+    while (drained < max_batch && tryPop(drain_batch_[drained])) {
+        drained++;
+    }
+    if (drained == 0) {
+        return 0;
+    }
+
+    std::vector<bool> accepted = kitchen.newOrders(std::make_move_iterator(drain_batch_.begin()),
+                                                   std::make_move_iterator(drain_batch_.begin() + drained));
+    int added = 0;
+    for (bool was_added : accepted) {
+        added += was_added;
+    }
+    int refused = drained - added;
+
+    orders_added_.fetch_add(added, std::memory_order_relaxed);
+    orders_refused_.fetch_add(refused, std::memory_order_relaxed);
+    return added;
+}
+
+int OrderTicketQueue::depth() const {
+    std::size_t dequeued = dequeue_pos_.load(std::memory_order_acquire);
+    std::size_t enqueued = enqueue_pos_.load(std::memory_order_acquire);
+    return enqueued > dequeued ? static_cast<int>(enqueued - dequeued) : 0;
+}
+
+int OrderTicketQueue::getCapacity() const {
+    return static_cast<int>(mask_ + 1);
+}
+
+OrderTicketQueue::Metrics OrderTicketQueue::getMetrics() const {
+    Metrics metrics;
+    metrics.dequeued = dequeue_pos_.load(std::memory_order_acquire);
+    metrics.enqueued = enqueue_pos_.load(std::memory_order_acquire);
+    metrics.rejected_full = rejected_full_.load(std::memory_order_relaxed);
+    metrics.orders_added = orders_added_.load(std::memory_order_relaxed);
+    metrics.orders_refused = orders_refused_.load(std::memory_order_relaxed);
+    metrics.depth = metrics.enqueued > metrics.dequeued ? static_cast<int>(metrics.enqueued - metrics.dequeued) : 0;
+    metrics.high_water_mark = high_water_mark_.load(std::memory_order_relaxed);
+    metrics.capacity = getCapacity();
+    return metrics;
+}
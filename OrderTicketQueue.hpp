@@ -0,0 +1,107 @@
+/**
+ * @file OrderTicketQueue.hpp
+ * @brief This file contains the declaration of the OrderTicketQueue class, a bounded lock-free queue of orders for a Kitchen.
+ *
+ * Any number of intake threads push tickets (Dish objects, moved in) while a single kitchen thread drains them in
+ * batches into a Kitchen, so a burst of orders never waits on the kitchen. The queue is a fixed ring of cells, each
+ * with a sequence number telling producers and the consumer whose turn it is; producers claim cells with one
+ * compare-and-swap. A full queue rejects the push instead of blocking, so callers see backpressure directly, and
+ * the metrics report the depth, its high-water mark and how many pushes were turned away.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef ORDER_TICKET_QUEUE_HPP
+#define ORDER_TICKET_QUEUE_HPP
+
+#include "Dish.hpp"
+#include "Kitchen.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class OrderTicketQueue {
+public:
+    /**
+     * Counters describing the traffic through the queue.
+     */
+    struct Metrics {
+        std::uint64_t enqueued = 0;        // tickets accepted by tryPush
+        std::uint64_t rejected_full = 0;   // pushes turned away because the queue was full
+        std::uint64_t dequeued = 0;        // tickets taken out by the consumer
+        std::uint64_t orders_added = 0;    // drained tickets the kitchen accepted
+        std::uint64_t orders_refused = 0;  // drained tickets the kitchen refused (duplicate or full)
+        int depth = 0;                     // tickets waiting right now
+        int high_water_mark = 0;           // largest depth right after a push
+        int capacity = 0;
+    };
+
+    /**
+     * Parameterized constructor.
+     * @param capacity The minimum number of tickets the queue can hold. It is rounded up to a power of two.
+     */
+    explicit OrderTicketQueue(int capacity);
+
+    OrderTicketQueue(const OrderTicketQueue&) = delete;
+    OrderTicketQueue& operator=(const OrderTicketQueue&) = delete;
+
+    /**
+     * May be called from any number of threads at once.
+     * @param a_dish The order to enqueue. It is moved from only if the push succeeds.
+     * @return True if the ticket was enqueued, false if the queue is full.
+     */
+    bool tryPush(Dish&& a_dish);
+
+    /**
+     * Must only be called from the single consumer thread.
+     * @param a_dish A reference receiving the oldest ticket.
+     * @return True if a ticket was dequeued, false if the queue is empty.
+     */
+    bool tryPop(Dish& a_dish);
+
+    /**
+     * Must only be called from the single consumer thread.
+     * @param kitchen A reference to the kitchen the tickets are added to.
+     * @param max_batch The maximum number of tickets to drain.
+     * @post Moves up to `max_batch` of the oldest tickets into the kitchen as one `Kitchen::newOrders` batch.
+     * @return The number of tickets the kitchen accepted.
+     */
+    int drainInto(Kitchen& kitchen, int max_batch);
+
+    /**
+     * @return The approximate number of tickets waiting. Exact when no thread is pushing or popping.
+     */
+    int depth() const;
+
+    /**
+     * @return The number of tickets the queue can hold.
+     */
+    int getCapacity() const;
+
+    /**
+     * @return The current counters. Each is read atomically; together they are approximate while threads are active.
+     */
+    Metrics getMetrics() const;
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        Dish dish;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_;  // capacity - 1
+    alignas(64) std::atomic<std::size_t> enqueue_pos_;
+    alignas(64) std::atomic<std::size_t> dequeue_pos_;
+    alignas(64) std::atomic<std::uint64_t> rejected_full_;
+    std::atomic<int> high_water_mark_;
+    // Written only by the consumer
+    alignas(64) std::atomic<std::uint64_t> orders_added_;
+    std::atomic<std::uint64_t> orders_refused_;
+    std::vector<Dish> drain_batch_;  // reused by drainInto
+};
+
+#endif // ORDER_TICKET_QUEUE_HPP
@@ -0,0 +1,124 @@
+/**
+ * @file PrepTimeIndex.cpp
+ * @brief This file contains the implementation of the PrepTimeIndex class, an ordered multiset of preparation times.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "PrepTimeIndex.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <utility>
+
+PrepTimeIndex::PrepTimeIndex(const PrepTimeIndex& other) {
+    std::lock_guard<std::mutex> lock(other.query_mutex_);
+    sorted_ = other.sorted_;
+    pending_inserts_ = other.pending_inserts_;
+    pending_erases_ = other.pending_erases_;
+}
+
+PrepTimeIndex::PrepTimeIndex(PrepTimeIndex&& other) noexcept
+    : sorted_(std::move(other.sorted_)), pending_inserts_(std::move(other.pending_inserts_)),
+      pending_erases_(std::move(other.pending_erases_)), merge_buffer_(std::move(other.merge_buffer_)) {
+}
+
+PrepTimeIndex& PrepTimeIndex::operator=(const PrepTimeIndex& other) {
+    if (this != &other) {
+        std::lock_guard<std::mutex> lock(other.query_mutex_);
+        sorted_ = other.sorted_;
+        pending_inserts_ = other.pending_inserts_;
+        pending_erases_ = other.pending_erases_;
+    }
+    return *this;
+}
+
+PrepTimeIndex& PrepTimeIndex::operator=(PrepTimeIndex&& other) noexcept {
+    sorted_ = std::move(other.sorted_);
+    pending_inserts_ = std::move(other.pending_inserts_);
+    pending_erases_ = std::move(other.pending_erases_);
+    merge_buffer_ = std::move(other.merge_buffer_);
+    return *this;
+}
+
+int PrepTimeIndex::size() const {
+    std::lock_guard<std::mutex> lock(query_mutex_);
+    return static_cast<int>(sorted_.size() + pending_inserts_.size() - pending_erases_.size());
+}
+
+void PrepTimeIndex::insert(int prep_time) {
+    pending_inserts_.push_back(prep_time);
+    mergeIfLarge();
+}
+
+void PrepTimeIndex::erase(int prep_time) {
+    pending_erases_.push_back(prep_time);
+    mergeIfLarge();
+}
+
+void PrepTimeIndex::clear() {
+    sorted_.clear();
+    pending_inserts_.clear();
+    pending_erases_.clear();
+}
+
+int PrepTimeIndex::countBelow(int threshold) const {
+    std::lock_guard<std::mutex> lock(query_mutex_);
+    merge();
+    return static_cast<int>(std::lower_bound(sorted_.begin(), sorted_.end(), threshold) - sorted_.begin());
+}
+
+int PrepTimeIndex::countInRange(int min_prep_time, int max_prep_time) const {
+    if (min_prep_time > max_prep_time) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(query_mutex_);
+    merge();
+    std::vector<int>::const_iterator first = std::lower_bound(sorted_.begin(), sorted_.end(), min_prep_time);
+    std::vector<int>::const_iterator last = std::upper_bound(first, sorted_.cend(), max_prep_time);
+    return static_cast<int>(last - first);
+}
+
+int PrepTimeIndex::percentile(double percent) const {
+    std::lock_guard<std::mutex> lock(query_mutex_);
+    merge();
+    if (sorted_.empty()) {
+        return 0;
+    }
+    double clamped = std::min(100.0, std::max(0.0, percent));
+    long long rank = static_cast<long long>(std::ceil(clamped / 100.0 * sorted_.size()));
+    return sorted_[rank > 0 ? rank - 1 : 0];
+}
+
+void PrepTimeIndex::mergeIfLarge() {
+    std::size_t pending = pending_inserts_.size() + pending_erases_.size();
+    if (pending >= static_cast<std::size_t>(MIN_MERGE_BATCH) && pending >= sorted_.size() / 8) {
+        merge();
+    }
+}
+
+void PrepTimeIndex::merge() const {
+    if (!pending_erases_.empty()) {
+        // An erase may refer to a time still waiting to be inserted, so apply the inserts first
+        std::sort(pending_inserts_.begin(), pending_inserts_.end());
+        merge_buffer_.clear();
+        std::merge(sorted_.begin(), sorted_.end(), pending_inserts_.begin(), pending_inserts_.end(),
+                   std::back_inserter(merge_buffer_));
+        pending_inserts_.clear();
+
+        std::sort(pending_erases_.begin(), pending_erases_.end());
+        sorted_.clear();
+        std::set_difference(merge_buffer_.begin(), merge_buffer_.end(), pending_erases_.begin(), pending_erases_.end(),
+                            std::back_inserter(sorted_));
+        pending_erases_.clear();
+    } else if (!pending_inserts_.empty()) {
+        // Merge through merge_buffer_ rather than std::inplace_merge, which allocates a temporary buffer per call
+        std::sort(pending_inserts_.begin(), pending_inserts_.end());
+        merge_buffer_.clear();
+        std::merge(sorted_.begin(), sorted_.end(), pending_inserts_.begin(), pending_inserts_.end(),
+                   std::back_inserter(merge_buffer_));
+        sorted_.swap(merge_buffer_);
+        pending_inserts_.clear();
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file PrepTimeIndex.hpp
+ * @brief This file contains the declaration of the PrepTimeIndex class, an ordered multiset of preparation times.
+ *
+ * PrepTimeIndex keeps the preparation times of a Kitchen's dishes in a sorted vector so that "how many dishes take
+ * less than / between ..." and percentile queries are answered with binary searches. Inserts and erases are collected
+ * in small unsorted buffers and merged into the sorted vector in batches of at least 1/8 of its size, so a stream of
+ * updates costs amortized O(log n) each instead of a vector insertion per update. Queries merge any pending updates
+ * first, so a query is O(log n) plus, if updates are pending, a merge that is O(n + k log k) for k pending updates.
+ *
+ * Threading: because a const query may merge, the queries lock an internal mutex around the merge and the search, so
+ * any number of threads may call the const functions at once. `insert`, `erase`, `clear` and assignment write
+ * without locking and must not run concurrently with any other call, as for a Kitchen's own mutations.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef PREP_TIME_INDEX_HPP
+#define PREP_TIME_INDEX_HPP
+
+#include <mutex>
+#include <vector>
+
+class PrepTimeIndex {
+public:
+    PrepTimeIndex() = default;
+
+    /**
+     * Copy and move constructors and assignment. Copying locks the source, so a copy may be taken while other
+     * threads query it.
+     * @param other The index to be copied or moved from.
+     */
+    PrepTimeIndex(const PrepTimeIndex& other);
+    PrepTimeIndex(PrepTimeIndex&& other) noexcept;
+    PrepTimeIndex& operator=(const PrepTimeIndex& other);
+    PrepTimeIndex& operator=(PrepTimeIndex&& other) noexcept;
+
+    /**
+     * @return The number of preparation times in the index.
+     */
+    int size() const;
+
+    /**
+     * @param prep_time A preparation time to add.
+     */
+    void insert(int prep_time);
+
+    /**
+     * @param prep_time A preparation time to remove. One occurrence is removed; it must be in the index.
+     */
+    void erase(int prep_time);
+
+    /**
+     * @post Removes all preparation times.
+     */
+    void clear();
+
+    /**
+     * @param threshold A preparation time in minutes.
+     * @return The number of preparation times less than the threshold.
+     */
+    int countBelow(int threshold) const;
+
+    /**
+     * @param min_prep_time The lower bound in minutes, inclusive.
+     * @param max_prep_time The upper bound in minutes, inclusive.
+     * @return The number of preparation times from `min_prep_time` to `max_prep_time`, 0 if the range is empty.
+     */
+    int countInRange(int min_prep_time, int max_prep_time) const;
+
+    /**
+     * @param percent A percentage from 0 to 100.
+     * @return The nearest-rank percentile: the smallest preparation time such that at least `percent`% of the
+     * preparation times are less than or equal to it. 0 if the index is empty.
+     */
+    int percentile(double percent) const;
+
+private:
+    // Pending updates are merged once they exceed this many, or 1/8 of the sorted vector
+    static const int MIN_MERGE_BATCH = 64;
+
+    mutable std::vector<int> sorted_;
+    mutable std::vector<int> pending_inserts_;
+    mutable std::vector<int> pending_erases_;
+    mutable std::vector<int> merge_buffer_;  // kept between merges so steady-state updates do not allocate
+    mutable std::mutex query_mutex_;         // held by the const functions, which may merge
+
+    /**
+     * @post Merges the pending inserts and erases into sorted_ if there are enough of them.
+     */
+    void mergeIfLarge();
+
+    /**
+     * @post Merges all pending inserts and erases into sorted_. The const callers hold query_mutex_.
+     */
+    void merge() const;
+};
+
+#endif // PREP_TIME_INDEX_HPP
@@ -0,0 +1,104 @@
+/**
+ * @file PrepTimeSketch.cpp
+ * @brief This file contains the implementation of the PrepTimeSketch class, a fixed-size mergeable histogram of
+ * preparation times.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "PrepTimeSketch.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// log2 of SUB_BUCKETS and of EXACT_LIMIT
+const int SUB_BUCKET_BITS = 3;
+const int EXACT_BITS = 7;
+
+static_assert((1 << SUB_BUCKET_BITS) == PrepTimeSketch::SUB_BUCKETS, "SUB_BUCKETS is a power of two");
+static_assert((1 << EXACT_BITS) == PrepTimeSketch::EXACT_LIMIT, "EXACT_LIMIT is a power of two");
+
+int highestBit(unsigned value) {
+    int bit = 0;
+    while (value >>= 1) {
+        ++bit;
+    }
+    return bit;
+}
+
+} // namespace
+
+PrepTimeSketch::Count PrepTimeSketch::size() const {
+    return size_;
+}
+
+void PrepTimeSketch::insert(int prep_time) {
+    buckets_[bucketOf(prep_time)]++;
+    size_++;
+}
+
+void PrepTimeSketch::erase(int prep_time) {
+    buckets_[bucketOf(prep_time)]--;
+    size_--;
+}
+
+void PrepTimeSketch::clear() {
+    buckets_.fill(0);
+    size_ = 0;
+}
+
+void PrepTimeSketch::merge(const PrepTimeSketch& other) {
+    for (int b = 0; b < BUCKET_COUNT; ++b) {
+        buckets_[b] += other.buckets_[b];
+    }
+    size_ += other.size_;
+}
+
+int PrepTimeSketch::percentile(double percent) const {
+    if (size_ <= 0) {
+        return 0;
+    }
+    double clamped = std::min(100.0, std::max(0.0, percent));
+    Count rank = static_cast<Count>(std::ceil(clamped / 100.0 * size_));
+    if (rank < 1) {
+        rank = 1;
+    }
+    Count seen = 0;
+    for (int b = 0; b < BUCKET_COUNT; ++b) {
+        seen += buckets_[b];
+        if (seen >= rank) {
+            return bucketLowerBound(b);
+        }
+    }
+    return bucketLowerBound(BUCKET_COUNT - 1);
+}
+
+int PrepTimeSketch::bucketOf(int prep_time) {
+    if (prep_time < EXACT_LIMIT) {
+        return prep_time > 0 ? prep_time : 0;
+    }
+    unsigned value = static_cast<unsigned>(prep_time);
+    int exponent = highestBit(value);
+    int sub_bucket = static_cast<int>(value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    return EXACT_LIMIT + (exponent - EXACT_BITS) * SUB_BUCKETS + sub_bucket;
+}
+
+int PrepTimeSketch::bucketLowerBound(int bucket) {
+    if (bucket < EXACT_LIMIT) {
+        return bucket;
+    }
+    int exponent = (bucket - EXACT_LIMIT) / SUB_BUCKETS + EXACT_BITS;
+    int sub_bucket = (bucket - EXACT_LIMIT) % SUB_BUCKETS;
+    return static_cast<int>(static_cast<unsigned>(SUB_BUCKETS + sub_bucket) << (exponent - SUB_BUCKET_BITS));
+}
+
+void PrepTimeSketch::setBucketCount(int bucket, Count count) {
+    size_ += count - buckets_[bucket];
+    buckets_[bucket] = count;
+}
+
+bool PrepTimeSketch::operator==(const PrepTimeSketch& other) const {
+    return size_ == other.size_ && buckets_ == other.buckets_;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file PrepTimeSketch.hpp
+ * @brief This file contains the declaration of the PrepTimeSketch class, a fixed-size mergeable histogram of
+ * preparation times.
+ *
+ * PrepTimeSketch counts preparation times in BUCKET_COUNT buckets: one bucket per minute below EXACT_LIMIT, then
+ * SUB_BUCKETS buckets per power of two, so percentiles are exact for preparation times below EXACT_LIMIT minutes and
+ * never more than 1/SUB_BUCKETS below the exact value above it. Unlike PrepTimeIndex it does not store the times
+ * themselves: sketches of any number of dishes take the same space, and two sketches merge by adding their buckets,
+ * which gives the same sketch as counting both sets of dishes in one. Times can also be removed again.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef PREP_TIME_SKETCH_HPP
+#define PREP_TIME_SKETCH_HPP
+
+#include <array>
+#include <cstdint>
+
+class PrepTimeSketch {
+public:
+    static const int EXACT_LIMIT = 128;
+    static const int SUB_BUCKETS = 8;
+    static const int BUCKET_COUNT = EXACT_LIMIT + (31 - 7) * SUB_BUCKETS;
+
+    typedef std::int64_t Count;
+
+    /**
+     * @return The number of preparation times in the sketch.
+     */
+    Count size() const;
+
+    /**
+     * @param prep_time A preparation time to count. Negative times are counted as 0.
+     */
+    void insert(int prep_time);
+
+    /**
+     * @param prep_time A preparation time to remove, which must have been counted.
+     */
+    void erase(int prep_time);
+
+    /**
+     * @post Removes all preparation times.
+     */
+    void clear();
+
+    /**
+     * @param other Another sketch.
+     * @post Adds the preparation times counted by `other` to this sketch.
+     */
+    void merge(const PrepTimeSketch& other);
+
+    /**
+     * @param percent A percentage from 0 to 100.
+     * @return The nearest-rank percentile, as in PrepTimeIndex::percentile, rounded down to the smallest time of
+     * its bucket. 0 if the sketch is empty.
+     */
+    int percentile(double percent) const;
+
+    /**
+     * @param prep_time A preparation time in minutes.
+     * @return The index of the bucket the preparation time is counted in.
+     */
+    static int bucketOf(int prep_time);
+
+    /**
+     * @param bucket A bucket index from 0 to BUCKET_COUNT - 1.
+     * @return The smallest preparation time counted in the bucket.
+     */
+    static int bucketLowerBound(int bucket);
+
+    /**
+     * @param bucket A bucket index from 0 to BUCKET_COUNT - 1.
+     * @return The number of preparation times counted in the bucket.
+     */
+    Count bucketCount(int bucket) const { return buckets_[bucket]; }
+
+    /**
+     * @param bucket A bucket index from 0 to BUCKET_COUNT - 1.
+     * @param count The number of preparation times to count in the bucket.
+     * @post Sets one bucket directly, e.g. when reading a sketch sent by another node.
+     */
+    void setBucketCount(int bucket, Count count);
+
+    bool operator==(const PrepTimeSketch& other) const;
+    bool operator!=(const PrepTimeSketch& other) const { return !(*this == other); }
+
+private:
+    std::array<Count, BUCKET_COUNT> buckets_{};
+    Count size_ = 0;
+};
+
+#endif
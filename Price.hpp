@@ -0,0 +1,87 @@
+/**
+ * @file Price.hpp
+ * @brief This file contains the declaration of the Price class, a fixed-point amount of money in integer cents.
+ *
+ * Dish stores its price as a Price so that equality is exact, hashing works on an integer, and kitchen-wide revenue
+ * totals are integer sums that do not drift. Conversions from double round to the nearest cent; amounts that are
+ * not finite or do not fit in Cents are rejected.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef PRICE_HPP
+#define PRICE_HPP
+
+#include <cmath>
+#include <cstdint>
+
+class Price {
+public:
+    typedef std::int64_t Cents;
+
+    /**
+     * Default constructor.
+     * Creates a price of zero.
+     */
+    constexpr Price() : cents_(0) {}
+
+    /**
+     * @param cents An amount in cents.
+     * @return The price of that many cents.
+     */
+    static constexpr Price fromCents(Cents cents) { return Price(cents); }
+
+    /**
+     * @param amount An amount in dollars.
+     * @param price The price to replace.
+     * @return true if `amount` is finite and fits in Cents once in cents, in which case `price` is replaced by it
+     * rounded to the nearest cent, halfway cases away from zero; false otherwise, in which case `price` is unchanged.
+     */
+    static bool fromDouble(double amount, Price& price) {
+        // 2^63 is exact as a double, and every double below it rounds to a Cents value
+        const double CENTS_LIMIT = 9223372036854775808.0;
+        double cents = amount * 100.0;
+        if (!(cents >= -CENTS_LIMIT && cents < CENTS_LIMIT)) {
+            return false;
+        }
+        price = Price(static_cast<Cents>(std::llround(cents)));
+        return true;
+    }
+
+    /**
+     * @param amount An amount in dollars.
+     * @return The price rounded to the nearest cent, halfway cases away from zero, or a price of zero if `amount`
+     * is NaN, infinite or out of range, see `fromDouble(double, Price&)`.
+     */
+    static Price fromDouble(double amount) {
+        Price price;
+        fromDouble(amount, price);
+        return price;
+    }
+
+    /**
+     * @return The price in cents.
+     */
+    constexpr Cents cents() const { return cents_; }
+
+    /**
+     * @return The price in dollars, as a double.
+     */
+    constexpr double toDouble() const { return static_cast<double>(cents_) / 100.0; }
+
+    constexpr bool operator==(const Price& rhs) const { return cents_ == rhs.cents_; }
+    constexpr bool operator!=(const Price& rhs) const { return cents_ != rhs.cents_; }
+    constexpr bool operator<(const Price& rhs) const { return cents_ < rhs.cents_; }
+    constexpr Price operator+(const Price& rhs) const { return Price(cents_ + rhs.cents_); }
+    constexpr Price operator-(const Price& rhs) const { return Price(cents_ - rhs.cents_); }
+    Price& operator+=(const Price& rhs) { cents_ += rhs.cents_; return *this; }
+    Price& operator-=(const Price& rhs) { cents_ -= rhs.cents_; return *this; }
+
+private:
+    constexpr explicit Price(Cents cents) : cents_(cents) {}
+
+    Cents cents_;
+};
+
+#endif // PRICE_HPP
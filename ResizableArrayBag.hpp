@@ -0,0 +1,287 @@
+/**
+ * @file ResizableArrayBag.hpp
+ * @brief This file contains the declaration and implementation of the ResizableArrayBag class template.
+ *
+ * ResizableArrayBag offers the same interface and protected members (`items_`, `item_count_`, `getIndexOf`) as
+ * ArrayBag, but stores its items in a heap array that grows geometrically instead of a fixed-size array. `add` only
+ * fails if memory cannot be allocated, capacity can be reserved ahead of a bulk load, and unused capacity can be
+ * released with `shrinkToFit`.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef RESIZABLE_ARRAY_BAG_HPP
+#define RESIZABLE_ARRAY_BAG_HPP
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+template<class ItemType>
+class ResizableArrayBag {
+public:
+    /**
+     * Default constructor.
+     * Creates an empty bag that has not allocated any storage yet.
+     */
+    ResizableArrayBag();
+
+    /**
+     * Copy constructor.
+     * @param other A reference to the bag to be copied. Only its items are copied, not its spare capacity.
+     */
+    ResizableArrayBag(const ResizableArrayBag& other);
+
+    /**
+     * Move constructor.
+     * @param other The bag whose storage is taken over. It is left empty.
+     */
+    ResizableArrayBag(ResizableArrayBag&& other) noexcept;
+
+    /**
+     * Copy/move assignment.
+     * @param other The bag to be copied or moved from.
+     */
+    ResizableArrayBag& operator=(ResizableArrayBag other) noexcept;
+
+    /**
+     * @return The number of items currently in the bag.
+     */
+    int getCurrentSize() const;
+
+    /**
+     * @return True if the bag is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @return The number of items the bag can hold before it has to grow.
+     */
+    int getCapacity() const;
+
+    /**
+     * @param new_entry A reference to the item to be added.
+     * @post Stores the item at the end of the bag, growing the storage if it is full.
+     * @return True, the bag never runs out of room.
+     */
+    bool add(const ItemType& new_entry);
+
+    /**
+     * @param new_entry The item to be moved into the bag.
+     * @post Stores the item at the end of the bag, growing the storage if it is full.
+     * @return True, the bag never runs out of room.
+     */
+    bool add(ItemType&& new_entry);
+
+    /**
+     * @param an_entry A reference to the item to be removed.
+     * @post If found, the item is removed and its slot is filled with the last item in the bag.
+     * @return True if the item was found and removed, false otherwise.
+     */
+    bool remove(const ItemType& an_entry);
+
+    /**
+     * @post The bag is empty. Its capacity is kept.
+     */
+    void clear();
+
+    /**
+     * @param an_entry A reference to the item to be found.
+     * @return True if the bag contains an item equal to `an_entry`, false otherwise.
+     */
+    bool contains(const ItemType& an_entry) const;
+
+    /**
+     * @param an_entry A reference to the item to be counted.
+     * @return The number of items in the bag equal to `an_entry`.
+     */
+    int getFrequencyOf(const ItemType& an_entry) const;
+
+    /**
+     * @return A vector holding copies of the items in the bag, in bag order.
+     */
+    std::vector<ItemType> toVector() const;
+
+    /**
+     * @param new_capacity The number of items the bag should be able to hold without growing.
+     * @post The capacity is at least `new_capacity`. Existing items are moved, not copied.
+     */
+    void reserve(int new_capacity);
+
+    /**
+     * @post The capacity equals the number of items in the bag.
+     */
+    void shrinkToFit();
+
+protected:
+    static const int MIN_GROWTH_CAPACITY = 8; // capacity of the first allocation
+    std::unique_ptr<ItemType[]> items_;         // array of bag items
+    int item_count_;                            // current count of bag items
+    int capacity_;                              // length of items_
+
+    /**
+     * @param target A reference to the item to be found.
+     * @return Either the index of the target in items_ or -1 if the bag does not contain it.
+     */
+    int getIndexOf(const ItemType& target) const;
+
+    /**
+     * @param min_capacity The number of items that must fit in the bag.
+     * @post If the capacity is less than `min_capacity`, the storage grows to the larger of
+     * `min_capacity` and twice the current capacity.
+     */
+    void ensureCapacity(int min_capacity);
+
+private:
+    /**
+     * @param new_capacity The exact capacity of the new storage, at least item_count_.
+     * @post The items are moved into a newly allocated array of `new_capacity` items.
+     */
+    void reallocate(int new_capacity);
+};
+
+template<class ItemType>
+ResizableArrayBag<ItemType>::ResizableArrayBag() : items_(nullptr), item_count_(0), capacity_(0) {
+}
+
+template<class ItemType>
+ResizableArrayBag<ItemType>::ResizableArrayBag(const ResizableArrayBag& other)
+    : items_(other.item_count_ > 0 ? new ItemType[other.item_count_] : nullptr),
+      item_count_(other.item_count_), capacity_(other.item_count_) {
+    for (int i = 0; i < item_count_; ++i) {
+        items_[i] = other.items_[i];
+    }
+}
+
+template<class ItemType>
+ResizableArrayBag<ItemType>::ResizableArrayBag(ResizableArrayBag&& other) noexcept
+    : items_(std::move(other.items_)), item_count_(other.item_count_), capacity_(other.capacity_) {
+    other.item_count_ = 0;
+    other.capacity_ = 0;
+}
+
+template<class ItemType>
+ResizableArrayBag<ItemType>& ResizableArrayBag<ItemType>::operator=(ResizableArrayBag other) noexcept {
+    std::swap(items_, other.items_);
+    std::swap(item_count_, other.item_count_);
+    std::swap(capacity_, other.capacity_);
+    return *this;
+}
+
+template<class ItemType>
+int ResizableArrayBag<ItemType>::getCurrentSize() const {
+    return item_count_;
+}
+
+template<class ItemType>
+bool ResizableArrayBag<ItemType>::isEmpty() const {
+    return item_count_ == 0;
+}
+
+template<class ItemType>
+int ResizableArrayBag<ItemType>::getCapacity() const {
+    return capacity_;
+}
+
+template<class ItemType>
+bool ResizableArrayBag<ItemType>::add(const ItemType& new_entry) {
+    ensureCapacity(item_count_ + 1);
+    items_[item_count_] = new_entry;
+    item_count_++;
+    return true;
+}
+
+template<class ItemType>
+bool ResizableArrayBag<ItemType>::add(ItemType&& new_entry) {
+    ensureCapacity(item_count_ + 1);
+    items_[item_count_] = std::move(new_entry);
+    item_count_++;
+    return true;
+}
+
+template<class ItemType>
+bool ResizableArrayBag<ItemType>::remove(const ItemType& an_entry) {
+    int found_index = getIndexOf(an_entry);
+    if (found_index < 0) {
+        return false;
+    }
+
+    item_count_--;
+    if (found_index != item_count_) {
+        items_[found_index] = std::move(items_[item_count_]);
+    }
+    return true;
+}
+
+template<class ItemType>
+void ResizableArrayBag<ItemType>::clear() {
+    item_count_ = 0;
+}
+
+template<class ItemType>
+bool ResizableArrayBag<ItemType>::contains(const ItemType& an_entry) const {
+    return getIndexOf(an_entry) > -1;
+}
+
+template<class ItemType>
+int ResizableArrayBag<ItemType>::getFrequencyOf(const ItemType& an_entry) const {
+    int frequency = 0;
+    for (int i = 0; i < item_count_; ++i) {
+        if (items_[i] == an_entry) {
+            frequency++;
+        }
+    }
+    return frequency;
+}
+
+template<class ItemType>
+std::vector<ItemType> ResizableArrayBag<ItemType>::toVector() const {
+    return std::vector<ItemType>(items_.get(), items_.get() + item_count_);
+}
+
+template<class ItemType>
+void ResizableArrayBag<ItemType>::reserve(int new_capacity) {
+    if (new_capacity > capacity_) {
+        reallocate(new_capacity);
+    }
+}
+
+template<class ItemType>
+void ResizableArrayBag<ItemType>::shrinkToFit() {
+    if (capacity_ > item_count_) {
+        reallocate(item_count_);
+    }
+}
+
+template<class ItemType>
+int ResizableArrayBag<ItemType>::getIndexOf(const ItemType& target) const {
+    for (int i = 0; i < item_count_; ++i) {
+        if (items_[i] == target) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+template<class ItemType>
+void ResizableArrayBag<ItemType>::ensureCapacity(int min_capacity) {
+    if (min_capacity <= capacity_) {
+        return;
+    }
+
+    int new_capacity = capacity_ < MIN_GROWTH_CAPACITY ? MIN_GROWTH_CAPACITY : capacity_ * 2;
+    reallocate(new_capacity < min_capacity ? min_capacity : new_capacity);
+}
+
+template<class ItemType>
+void ResizableArrayBag<ItemType>::reallocate(int new_capacity) {
+    std::unique_ptr<ItemType[]> new_items(new_capacity > 0 ? new ItemType[new_capacity] : nullptr);
+    for (int i = 0; i < item_count_; ++i) {
+        new_items[i] = std::move(items_[i]);
+    }
+    items_ = std::move(new_items);
+    capacity_ = new_capacity;
+}
+
+#endif // RESIZABLE_ARRAY_BAG_HPP
@@ -0,0 +1,75 @@
+/**
+ * @file StringPool.cpp
+ * @brief This file contains the implementation of the StringPool class, which interns the strings used by dishes.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "StringPool.hpp"
+#include <stdexcept>
+
+StringPool::StringPool() : StringPool(MAX_SIZE) {
+}
+
+StringPool::StringPool(Id max_size) : count_(0), max_size_(max_size < MAX_SIZE ? max_size : MAX_SIZE) {
+    for (int i = 0; i < MAX_CHUNKS; ++i) {
+        chunks_[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+StringPool::~StringPool() {
+    for (int i = 0; i < MAX_CHUNKS; ++i) {
+        delete[] chunks_[i].load(std::memory_order_relaxed);
+    }
+}
+
+StringPool::Id StringPool::intern(std::string_view value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto found = ids_.find(value);
+    if (found != ids_.end()) {
+        return found->second;
+    }
+
+    Id id = count_.load(std::memory_order_relaxed);
+    if (id >= max_size_) {
+        throw std::length_error("StringPool is full");
+    }
+    int chunk_index = static_cast<int>(id >> CHUNK_BITS);
+
+    std::string* chunk = chunks_[chunk_index].load(std::memory_order_relaxed);
+    if (chunk == nullptr) {
+        chunk = new std::string[CHUNK_SIZE];
+        chunks_[chunk_index].store(chunk, std::memory_order_release);
+    }
+
+    std::string& pooled = chunk[id & (CHUNK_SIZE - 1)];
+    pooled.assign(value.data(), value.size());
+    ids_.emplace(std::string_view(pooled), id);
+    count_.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+bool StringPool::find(std::string_view value, Id& id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto found = ids_.find(value);
+    if (found == ids_.end()) {
+        return false;
+    }
+    id = found->second;
+    return true;
+}
+
+const std::string& StringPool::lookup(Id id) const {
+    const std::string* chunk = chunks_[id >> CHUNK_BITS].load(std::memory_order_acquire);
+    return chunk[id & (CHUNK_SIZE - 1)];
+}
+
+int StringPool::size() const {
+    return static_cast<int>(count_.load(std::memory_order_acquire));
+}
+
+StringPool& StringPool::global() {
+    static StringPool pool;
+    return pool;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file StringPool.hpp
+ * @brief This file contains the declaration of the StringPool class, which interns the strings used by dishes.
+ *
+ * Each distinct string is stored once and identified by a compact integer Id. Dishes keep Ids for their name and
+ * ingredients instead of their own copies, so equal names compare by Id and repeated ingredients cost 4 bytes each.
+ * Interned strings are never moved or freed while the pool exists, so references returned by `lookup` stay valid.
+ * `intern` and `find` may be called from several threads; `lookup` does not take a lock.
+ *
+ * A pool only grows: there is no way to remove a string, and memory comes back only when the pool is destroyed.
+ * `global()`, which holds every dish name and ingredient, lives until the process exits, so a long-running process
+ * that keeps seeing new names keeps every one of them. A pool holds at most MAX_SIZE (16,777,216) strings, fewer if its
+ * constructor is given a smaller limit; `intern` of a further string throws std::length_error and leaves the pool
+ * unchanged. Building with DISH_NO_STRING_POOL makes each Dish own its strings instead, see Dish.hpp.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef STRING_POOL_HPP
+#define STRING_POOL_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+class StringPool {
+public:
+    typedef std::uint32_t Id;
+
+    // The most strings a pool can hold
+    static const Id MAX_SIZE = Id(1) << 24;
+
+    /**
+     * Default constructor.
+     * Creates an empty pool that holds up to MAX_SIZE strings.
+     */
+    StringPool();
+
+    /**
+     * Parameterized constructor.
+     * @param max_size The most strings the pool may hold, at most MAX_SIZE.
+     */
+    explicit StringPool(Id max_size);
+
+    /**
+     * Destructor.
+     * Frees all interned strings. References returned by `lookup` become invalid.
+     */
+    ~StringPool();
+
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    /**
+     * @param value The string to be interned.
+     * @return The Id of the pooled copy of the string. Interning an equal string again returns the same Id.
+     * @post If the string was not in the pool, a copy of it is added.
+     * @throws std::length_error If the string is not in the pool and the pool already holds its maximum size.
+     */
+    Id intern(std::string_view value);
+
+    /**
+     * @param value The string to be found.
+     * @param id A reference set to the Id of the string if it is in the pool.
+     * @return True if the string is in the pool, false otherwise. The pool is not modified.
+     */
+    bool find(std::string_view value, Id& id) const;
+
+    /**
+     * @param id An Id returned by `intern`.
+     * @return A const reference to the interned string, valid for the lifetime of the pool.
+     */
+    const std::string& lookup(Id id) const;
+
+    /**
+     * @return The number of distinct strings in the pool.
+     */
+    int size() const;
+
+    /**
+     * @return The process-wide pool used by Dish.
+     */
+    static StringPool& global();
+
+private:
+    static const int CHUNK_BITS = 12;
+    static const int CHUNK_SIZE = 1 << CHUNK_BITS;  // strings per chunk
+    static const int MAX_CHUNKS = MAX_SIZE >> CHUNK_BITS;  // chunks the directory can hold
+
+    // Strings live in fixed-size chunks that are never reallocated, so lookups need no lock.
+    std::atomic<std::string*> chunks_[MAX_CHUNKS];
+    std::atomic<Id> count_;
+    Id max_size_;
+    std::unordered_map<std::string_view, Id> ids_;  // views into the pooled strings -> Id
+    mutable std::mutex mutex_;                      // guards ids_ and appending to the chunks
+};
+
+#endif // STRING_POOL_HPP
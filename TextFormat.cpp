@@ -0,0 +1,35 @@
+/**
+ * @file TextFormat.cpp
+ * @brief This file contains the implementation of helper functions that append formatted numbers to a string buffer.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "TextFormat.hpp"
+#include <charconv>
+
+void appendInteger(std::string& buffer, long long value) {
+    char digits[24];
+    std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+    buffer.append(digits, result.ptr);
+}
+
+void appendFixed2(std::string& buffer, double value) {
+    char digits[352]; // enough for any double in fixed notation
+    std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::fixed, 2);
+    buffer.append(digits, result.ptr);
+}
+
+void appendCents(std::string& buffer, long long cents) {
+    unsigned long long magnitude = cents < 0 ? 0ULL - static_cast<unsigned long long>(cents) : cents;
+    if (cents < 0) {
+        buffer += '-';
+    }
+    char digits[24];
+    std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), magnitude / 100);
+    buffer.append(digits, result.ptr);
+    buffer += '.';
+    buffer += static_cast<char>('0' + magnitude % 100 / 10);
+    buffer += static_cast<char>('0' + magnitude % 10);
+}
@@ -0,0 +1,36 @@
+/**
+ * @file TextFormat.hpp
+ * @brief This file contains the declaration of helper functions that append formatted numbers to a string buffer.
+ *
+ * The helpers format with std::to_chars into a stack buffer and append the result, so building report and display
+ * text allocates only when the destination string has to grow, and never touches an iostream.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef TEXT_FORMAT_HPP
+#define TEXT_FORMAT_HPP
+
+#include <string>
+
+/**
+ * @param buffer A reference to the string the number is appended to.
+ * @param value The integer to append, in decimal.
+ */
+void appendInteger(std::string& buffer, long long value);
+
+/**
+ * @param buffer A reference to the string the number is appended to.
+ * @param value The number to append, in fixed notation with two decimal places (the same text as
+ * `std::fixed << std::setprecision(2)`).
+ */
+void appendFixed2(std::string& buffer, double value);
+
+/**
+ * @param buffer A reference to the string the amount is appended to.
+ * @param cents An amount in cents, appended exactly in dollars with two decimal places, e.g. 1205 as "12.05".
+ */
+void appendCents(std::string& buffer, long long cents);
+
+#endif // TEXT_FORMAT_HPP
@@ -0,0 +1,106 @@
+/**
+ * @file CompactDishBenchmark.cpp
+ * @brief This file contains a benchmark comparing scan throughput over Dish and CompactDish arrays.
+ *
+ * Both scans compute what kitchenReport needs from every dish: the preparation time sum, the elaborate count and
+ * the per-cuisine counts. It is the CompactDishBenchmark target of the CMake build, see README.md.
+ * Usage: CompactDishBenchmark [dish_count] [repetitions]
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "CompactDish.hpp"
+#include "Dish.hpp"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct ScanResult {
+    long long prep_time_sum = 0;
+    int elaborate_count = 0;
+    std::array<int, Dish::CUISINE_TYPE_COUNT> cuisine_counts{};
+};
+
+// A valid (letters only) dish name for each index, so no dish falls back to UNKNOWN
+std::string dishName(int index) {
+    std::string name = "Dish ";
+    do {
+        name += static_cast<char>('a' + index % 26);
+        index /= 26;
+    } while (index > 0);
+    return name;
+}
+
+bool isElaborate(const Dish& a_dish) {
+    return a_dish.getIngredientCount() >= 5 && a_dish.getPrepTime() >= 60;
+}
+
+ScanResult scanDishes(const std::vector<Dish>& dishes) {
+    ScanResult result;
+    for (const Dish& a_dish : dishes) {
+        result.prep_time_sum += a_dish.getPrepTime();
+        result.elaborate_count += isElaborate(a_dish);
+        result.cuisine_counts[a_dish.getCuisineTypeEnum()]++;
+    }
+    return result;
+}
+
+ScanResult scanCompactDishes(const std::vector<CompactDish>& dishes) {
+    ScanResult result;
+    for (const CompactDish& a_dish : dishes) {
+        result.prep_time_sum += a_dish.getPrepTime();
+        result.elaborate_count += a_dish.isElaborate();
+        result.cuisine_counts[a_dish.getCuisineTypeEnum()]++;
+    }
+    return result;
+}
+
+template<class Container, class Scan>
+double nanosecondsPerDish(const Container& dishes, Scan scan, int repetitions, long long& checksum) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; ++i) {
+        ScanResult result = scan(dishes);
+        checksum += result.prep_time_sum + result.elaborate_count + result.cuisine_counts[Dish::OTHER];
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / (static_cast<double>(dishes.size()) * repetitions);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int dish_count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int repetitions = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    std::vector<Dish> dishes;
+    std::vector<CompactDish> compact_dishes;
+    dishes.reserve(dish_count);
+    compact_dishes.reserve(dish_count);
+    for (int i = 0; i < dish_count; ++i) {
+        std::vector<std::string> ingredients;
+        for (int j = 0; j < i % 8; ++j) {
+            ingredients.push_back("Ingredient" + std::to_string(j));
+        }
+        dishes.emplace_back(dishName(i % 1000), std::move(ingredients), i % 120, (i % 5000) / 100.0,
+                            static_cast<Dish::CuisineType>(i % Dish::CUISINE_TYPE_COUNT));
+        compact_dishes.emplace_back(dishes.back(), isElaborate(dishes.back()));
+    }
+
+    long long checksum = 0;
+    double dish_ns = nanosecondsPerDish(dishes, scanDishes, repetitions, checksum);
+    double compact_ns = nanosecondsPerDish(compact_dishes, scanCompactDishes, repetitions, checksum);
+
+    std::printf("dishes: %d, repetitions: %d\n", dish_count, repetitions);
+    std::printf("Dish        (%2zu bytes): %6.3f ns/dish, %8.1f MB/s\n", sizeof(Dish), dish_ns,
+                sizeof(Dish) / dish_ns * 1000.0);
+    std::printf("CompactDish (%2zu bytes): %6.3f ns/dish, %8.1f MB/s\n", sizeof(CompactDish), compact_ns,
+                sizeof(CompactDish) / compact_ns * 1000.0);
+    std::printf("speedup: %.2fx (checksum %lld)\n", dish_ns / compact_ns, checksum);
+    return 0;
+}
@@ -0,0 +1,341 @@
+/**
+ * @file KitchenBenchmark.cpp
+ * @brief This file contains a Google Benchmark suite for the Dish and Kitchen operations.
+ *
+ * Every Kitchen benchmark runs at bag sizes from 10 to 1,000,000 dishes, built from a generated menu shaped like a
+ * real one: cuisines follow a skewed distribution (ITALIAN most common, FRENCH rarest), ingredients are drawn with
+ * a Zipf-like bias from a small vocabulary so the same few repeat across dishes, and preparation times cluster
+ * around half an hour with a long tail. Menus are generated from a fixed seed, so runs are comparable.
+ *
+ * It is the KitchenBenchmark target of the CMake build, built when Google Benchmark is found, see README.md:
+ *     cmake -S . -B build && cmake --build build --target KitchenBenchmark
+ * Usage: KitchenBenchmark [--benchmark_filter=<regex>] and the other Google Benchmark flags.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "Dish.hpp"
+#include "Kitchen.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const int MIN_BAG_SIZE = 10;
+const int MAX_BAG_SIZE = 1000000;
+
+// Share of each cuisine in generated menus, in CuisineType order
+const std::array<double, Dish::CUISINE_TYPE_COUNT> CUISINE_WEIGHTS = { 30, 20, 15, 12, 10, 3, 10 };
+
+const char* const INGREDIENTS[] = {
+    "Salt", "Olive Oil", "Garlic", "Onion", "Tomato", "Butter", "Pepper", "Flour", "Cheese", "Rice",
+    "Chicken", "Basil", "Cilantro", "Lime", "Ginger", "Soy Sauce", "Cumin", "Cream", "Egg", "Beef",
+    "Pork", "Shrimp", "Mushroom", "Spinach", "Chili", "Coriander", "Paprika", "Lemon", "Parsley", "Thyme",
+    "Noodles", "Beans", "Corn", "Potato", "Carrot", "Celery", "Wine", "Vinegar", "Honey", "Sesame" };
+const int INGREDIENT_COUNT = sizeof(INGREDIENTS) / sizeof(INGREDIENTS[0]);
+
+// A unique, valid (letters only) dish name for each index
+std::string dishName(int index) {
+    std::string name = "Dish ";
+    do {
+        name += static_cast<char>('a' + index % 26);
+        index /= 26;
+    } while (index > 0);
+    return name;
+}
+
+/**
+ * Generates the dishes of a menu. The first `count` dishes are distinct, so a kitchen accepts all of them.
+ */
+class MenuGenerator {
+public:
+    explicit MenuGenerator(std::uint32_t seed)
+        : random_(seed), cuisine_(CUISINE_WEIGHTS.begin(), CUISINE_WEIGHTS.end()), prep_time_(3.3, 0.6),
+          ingredient_count_(1, 9), price_cents_(499, 4999) {
+        std::vector<double> weights(INGREDIENT_COUNT);
+        for (int i = 0; i < INGREDIENT_COUNT; ++i) {
+            weights[i] = 1.0 / (i + 1);
+        }
+        ingredient_ = std::discrete_distribution<int>(weights.begin(), weights.end());
+    }
+
+    Dish dish(int index) {
+        std::vector<std::string> ingredients;
+        int count = ingredient_count_(random_);
+        for (int i = 0; i < count; ++i) {
+            ingredients.push_back(INGREDIENTS[ingredient_(random_)]);
+        }
+        int prep_time = static_cast<int>(prep_time_(random_));
+        if (prep_time > 240) {
+            prep_time = 240;
+        }
+        Dish a_dish(dishName(index), std::move(ingredients), prep_time, 0.0,
+                    static_cast<Dish::CuisineType>(cuisine_(random_)));
+        a_dish.setPrice(Price::fromCents(price_cents_(random_)));
+        return a_dish;
+    }
+
+    std::vector<Dish> menu(int count) {
+        std::vector<Dish> dishes;
+        dishes.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            dishes.push_back(dish(i));
+        }
+        return dishes;
+    }
+
+private:
+    std::mt19937 random_;
+    std::discrete_distribution<int> cuisine_;
+    std::discrete_distribution<int> ingredient_;
+    std::lognormal_distribution<double> prep_time_;  // median about 27 minutes
+    std::uniform_int_distribution<int> ingredient_count_;
+    std::uniform_int_distribution<int> price_cents_;
+};
+
+// Menus are generated once per size and shared by the benchmarks
+const std::vector<Dish>& menuOfSize(int count) {
+    static std::map<int, std::vector<Dish>> menus;
+    std::vector<Dish>& menu = menus[count];
+    if (menu.empty()) {
+        menu = MenuGenerator(235).menu(count);
+    }
+    return menu;
+}
+
+Kitchen kitchenOf(const std::vector<Dish>& menu) {
+    Kitchen kitchen;
+    kitchen.reserve(static_cast<int>(menu.size()));
+    kitchen.newOrders(menu.begin(), menu.end());
+    return kitchen;
+}
+
+// The preparation time below which about `percent` percent of the menu's dishes fall
+int prepTimeAtPercent(const std::vector<Dish>& menu, int percent) {
+    std::vector<int> prep_times;
+    prep_times.reserve(menu.size());
+    for (const Dish& a_dish : menu) {
+        prep_times.push_back(a_dish.getPrepTime());
+    }
+    std::size_t rank = prep_times.size() * percent / 100;
+    std::nth_element(prep_times.begin(), prep_times.begin() + rank, prep_times.end());
+    return prep_times[rank];
+}
+
+void bagSizes(benchmark::internal::Benchmark* benchmark) {
+    for (int size = MIN_BAG_SIZE; size <= MAX_BAG_SIZE; size *= 10) {
+        benchmark->Arg(size);
+    }
+}
+
+void bagSizesAndSelectivities(benchmark::internal::Benchmark* benchmark) {
+    for (int size = MIN_BAG_SIZE; size <= MAX_BAG_SIZE; size *= 10) {
+        for (int percent : { 1, 10, 50, 90 }) {
+            benchmark->Args({ size, percent });
+        }
+    }
+}
+
+// Adds a whole menu of distinct dishes to an empty kitchen, one newOrder per dish
+void BM_NewOrderUnique(benchmark::State& state) {
+    const std::vector<Dish>& menu = menuOfSize(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        Kitchen kitchen;
+        for (const Dish& a_dish : menu) {
+            benchmark::DoNotOptimize(kitchen.newOrder(a_dish));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(menu.size()));
+}
+BENCHMARK(BM_NewOrderUnique)->Apply(bagSizes)->Unit(benchmark::kMicrosecond);
+
+// Offers dishes already in a full kitchen, so every newOrder is rejected as a duplicate
+void BM_NewOrderDuplicate(benchmark::State& state) {
+    const std::vector<Dish>& menu = menuOfSize(static_cast<int>(state.range(0)));
+    Kitchen kitchen = kitchenOf(menu);
+    std::size_t next = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kitchen.newOrder(menu[next]));
+        next = (next + 1 == menu.size()) ? 0 : next + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NewOrderDuplicate)->Apply(bagSizes);
+
+// Same as BM_NewOrderDuplicate without the dish index, i.e. with a linear scan per order
+void BM_NewOrderDuplicateNoIndex(benchmark::State& state) {
+    const std::vector<Dish>& menu = menuOfSize(static_cast<int>(state.range(0)));
+    Kitchen kitchen = kitchenOf(menu);
+    kitchen.setDishIndexEnabled(false);
+    std::size_t next = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kitchen.newOrder(menu[next]));
+        next = (next + 1 == menu.size()) ? 0 : next + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NewOrderDuplicateNoIndex)->Apply(bagSizes);
+
+// Serves a dish that is in the kitchen, then orders it again so the kitchen keeps its size
+void BM_ServeDishHit(benchmark::State& state) {
+    const std::vector<Dish>& menu = menuOfSize(static_cast<int>(state.range(0)));
+    Kitchen kitchen = kitchenOf(menu);
+    std::size_t next = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kitchen.serveDish(menu[next]));
+        kitchen.newOrder(menu[next]);
+        next = (next + 1 == menu.size()) ? 0 : next + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ServeDishHit)->Apply(bagSizes);
+
+// Serves dishes that are not in the kitchen
+void BM_ServeDishMiss(benchmark::State& state) {
+    const std::vector<Dish>& menu = menuOfSize(static_cast<int>(state.range(0)));
+    Kitchen kitchen = kitchenOf(menu);
+    std::vector<Dish> absent = MenuGenerator(981).menu(64);
+    for (Dish& a_dish : absent) {
+        a_dish.setName(a_dish.getName() + " Special");
+    }
+    std::size_t next = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kitchen.serveDish(absent[next]));
+        next = (next + 1) % absent.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ServeDishMiss)->Apply(bagSizes);
+
+void BM_TallyCuisineTypes(benchmark::State& state) {
+    Kitchen kitchen = kitchenOf(menuOfSize(static_cast<int>(state.range(0))));
+    const std::string cuisines[] = { "ITALIAN", "FRENCH", "OTHER" };
+    int next = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kitchen.tallyCuisineTypes(cuisines[next]));
+        next = (next + 1) % 3;
+    }
+}
+BENCHMARK(BM_TallyCuisineTypes)->Apply(bagSizes);
+
+// Releases about range(1) percent of the kitchen by preparation time; the kitchen is rebuilt outside the timing
+void BM_ReleaseDishesBelowPrepTime(benchmark::State& state) {
+    const std::vector<Dish>& menu = menuOfSize(static_cast<int>(state.range(0)));
+    const Kitchen full_kitchen = kitchenOf(menu);
+    const int threshold = prepTimeAtPercent(menu, static_cast<int>(state.range(1)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        Kitchen kitchen = full_kitchen;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(kitchen.releaseDishesBelowPrepTime(threshold));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(menu.size()));
+}
+BENCHMARK(BM_ReleaseDishesBelowPrepTime)->Apply(bagSizesAndSelectivities)->Unit(benchmark::kMicrosecond);
+
+// Releases one cuisine, from the most common (ITALIAN, about 30%) to the rarest (FRENCH, about 3%)
+void BM_ReleaseDishesOfCuisineType(benchmark::State& state) {
+    const std::vector<Dish>& menu = menuOfSize(static_cast<int>(state.range(0)));
+    const Kitchen full_kitchen = kitchenOf(menu);
+    const std::string cuisine = Dish::CUISINE_TYPE_NAMES[state.range(1)].data();
+    for (auto _ : state) {
+        state.PauseTiming();
+        Kitchen kitchen = full_kitchen;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(kitchen.releaseDishesOfCuisineType(cuisine));
+    }
+    state.SetLabel(cuisine);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(menu.size()));
+}
+BENCHMARK(BM_ReleaseDishesOfCuisineType)
+    ->ArgsProduct({ benchmark::CreateRange(MIN_BAG_SIZE, MAX_BAG_SIZE, 10), { Dish::ITALIAN, Dish::FRENCH } })
+    ->Unit(benchmark::kMicrosecond);
+
+// releaseIf and parallelReleaseIf with the same predicate, releasing about range(1) percent of the kitchen
+template<bool PARALLEL>
+void BM_ReleaseIfPrepTime(benchmark::State& state) {
+    const std::vector<Dish>& menu = menuOfSize(static_cast<int>(state.range(0)));
+    const Kitchen full_kitchen = kitchenOf(menu);
+    const int threshold = prepTimeAtPercent(menu, static_cast<int>(state.range(1)));
+    auto below_threshold = [threshold](const Dish& a_dish) { return a_dish.getPrepTime() < threshold; };
+    for (auto _ : state) {
+        state.PauseTiming();
+        Kitchen kitchen = full_kitchen;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(PARALLEL ? kitchen.parallelReleaseIf(below_threshold)
+                                          : kitchen.releaseIf(below_threshold));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(menu.size()));
+}
+BENCHMARK_TEMPLATE(BM_ReleaseIfPrepTime, false)->Apply(bagSizesAndSelectivities)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ReleaseIfPrepTime, true)->Apply(bagSizesAndSelectivities)->Unit(benchmark::kMicrosecond);
+
+// Steady-state expiry: dish i is ordered at time i with a TTL of the kitchen size, so every tick
+// expires the oldest dish, which is then ordered again
+void BM_ExpireOrdersTick(benchmark::State& state) {
+    const std::vector<Dish>& menu = menuOfSize(static_cast<int>(state.range(0)));
+    const std::int64_t size = static_cast<std::int64_t>(menu.size());
+    Kitchen kitchen;
+    kitchen.setOrderTtl(size);
+    for (std::int64_t i = 0; i < size; ++i) {
+        kitchen.expireOrders(i);
+        kitchen.newOrder(menu[static_cast<std::size_t>(i)]);
+    }
+    std::int64_t now = size;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kitchen.expireOrders(now));
+        kitchen.newOrder(menu[static_cast<std::size_t>(now % size)]);
+        ++now;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ExpireOrdersTick)->Apply(bagSizes);
+
+void BM_KitchenReport(benchmark::State& state) {
+    Kitchen kitchen = kitchenOf(menuOfSize(static_cast<int>(state.range(0))));
+    std::ostringstream out;
+    for (auto _ : state) {
+        out.str(std::string());
+        kitchen.kitchenReport(out);
+    }
+}
+BENCHMARK(BM_KitchenReport)->Apply(bagSizes);
+
+// Dish copy and move pass a dish back and forth between two objects, two assignments per iteration. In the default
+// pooled build a Dish owns no heap memory and both cost the same; with DISH_NO_STRING_POOL a copy allocates.
+void BM_DishCopy(benchmark::State& state) {
+    Dish first = MenuGenerator(17).dish(0);
+    Dish second;
+    for (auto _ : state) {
+        second = first;
+        benchmark::DoNotOptimize(second);
+        first = second;
+        benchmark::DoNotOptimize(first);
+    }
+}
+BENCHMARK(BM_DishCopy);
+
+void BM_DishMove(benchmark::State& state) {
+    Dish first = MenuGenerator(17).dish(0);
+    Dish second;
+    for (auto _ : state) {
+        second = std::move(first);
+        benchmark::DoNotOptimize(second);
+        first = std::move(second);
+        benchmark::DoNotOptimize(first);
+    }
+}
+BENCHMARK(BM_DishMove);
+
+} // namespace
+
+BENCHMARK_MAIN();
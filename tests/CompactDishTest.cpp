@@ -0,0 +1,76 @@
+/**
+ * @file CompactDishTest.cpp
+ * @brief This file contains the tests of CompactDish: packing keeps every field, including preparation times and
+ * prices too wide for the hot fields, and equality agrees with Dish::operator==.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "CompactDish.hpp"
+#include "TestSupport.hpp"
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace {
+
+Dish dishWith(int prep_time, Price::Cents cents) {
+    Dish a_dish("Stew", { "Beef", "Onion" }, prep_time, 0.0, Dish::FRENCH);
+    a_dish.setPrice(Price::fromCents(cents));
+    return a_dish;
+}
+
+void checkPacked(const Dish& a_dish) {
+    CompactDish compact(a_dish, true);
+    KITCHEN_CHECK(compact.getPrepTime() == a_dish.getPrepTime());
+    KITCHEN_CHECK(compact.getPriceCents() == a_dish.getPriceValue().cents());
+    KITCHEN_CHECK(compact.getName() == a_dish.getName());
+    KITCHEN_CHECK(compact.getIngredientCount() == a_dish.getIngredientCount());
+    KITCHEN_CHECK(compact.getCuisineTypeEnum() == a_dish.getCuisineTypeEnum());
+    KITCHEN_CHECK(compact.isElaborate());
+    Dish unpacked = compact.toDish();
+    KITCHEN_CHECK(unpacked == a_dish);
+    KITCHEN_CHECK(unpacked.getIngredient(1) == "Onion");
+}
+
+void testRoundTrip() {
+    const int PREP_TIMES[] = { 0, 45, CompactDish::MAX_PREP_TIME, CompactDish::MAX_PREP_TIME + 1, -1, 1000000,
+                               std::numeric_limits<int>::max(), std::numeric_limits<int>::min() };
+    const Price::Cents PRICES[] = { 0, 1250, -5, std::numeric_limits<std::int32_t>::max(),
+                                    Price::Cents(std::numeric_limits<std::int32_t>::max()) + 1,
+                                    Price::Cents(std::numeric_limits<std::int32_t>::min()) - 1,
+                                    std::numeric_limits<Price::Cents>::max(),
+                                    std::numeric_limits<Price::Cents>::min() };
+    for (int prep_time : PREP_TIMES) {
+        for (Price::Cents cents : PRICES) {
+            checkPacked(dishWith(prep_time, cents));
+        }
+    }
+    KITCHEN_CHECK(!CompactDish(dishWith(45, 1250), false).isWide());
+    KITCHEN_CHECK(CompactDish(dishWith(CompactDish::MAX_PREP_TIME + 1, 1250), false).isWide());
+    KITCHEN_CHECK(CompactDish(dishWith(45, Price::Cents(1) << 40), false).isWide());
+}
+
+void testEqualityMatchesDish() {
+    // Dishes that used to clamp to the same hot fields must stay distinct
+    std::vector<Dish> dishes = {
+        dishWith(70000, 1250), dishWith(80000, 1250), dishWith(-3, 1250), dishWith(0, 1250),
+        dishWith(45, Price::Cents(1) << 40), dishWith(45, (Price::Cents(1) << 40) + 1),
+        dishWith(45, std::numeric_limits<std::int32_t>::max()), dishWith(70000, 1250),
+    };
+    for (const Dish& a : dishes) {
+        CompactDish compact_a(a, false);
+        for (const Dish& b : dishes) {
+            KITCHEN_CHECK((compact_a == CompactDish(b, false)) == (a == b));
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    testRoundTrip();
+    testEqualityMatchesDish();
+    return 0;
+}
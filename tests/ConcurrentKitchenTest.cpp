@@ -0,0 +1,94 @@
+/**
+ * @file ConcurrentKitchenTest.cpp
+ * @brief This file contains the tests of ConcurrentKitchen: its lock-free totals once writers are done, and views that
+ * stay whole while writers run.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "ConcurrentKitchen.hpp"
+#include "TestSupport.hpp"
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @post Checks that the view's statistics are those of its own dishes.
+ */
+void checkViewIsWhole(const KitchenView& view) {
+    long long prep_time_sum = 0;
+    long long revenue_cents = 0;
+    long long cuisine_total = 0;
+    view.forEachDish([&](const Dish& a_dish) {
+        prep_time_sum += a_dish.getPrepTime();
+        revenue_cents += a_dish.getPriceValue().cents();
+    });
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+        cuisine_total += view.stats().getCuisineCount(static_cast<Dish::CuisineType>(c));
+    }
+    KITCHEN_CHECK(view.stats().getDishCount() == view.getCurrentSize());
+    KITCHEN_CHECK(view.stats().getPrepTimeSum() == prep_time_sum);
+    KITCHEN_CHECK(view.stats().getRevenue().cents() == revenue_cents);
+    KITCHEN_CHECK(cuisine_total == view.getCurrentSize());
+}
+
+void testViewsWhileWriting() {
+    const int WRITERS = 3;
+    const int DISHES_PER_WRITER = 2000;
+    ConcurrentKitchen kitchen(4);
+    std::atomic<int> writers_done{0};
+    std::vector<std::thread> threads;
+    for (int w = 0; w < WRITERS; ++w) {
+        threads.emplace_back([&kitchen, &writers_done, w]() {
+            std::mt19937 random(w);
+            for (int i = 0; i < DISHES_PER_WRITER; ++i) {
+                kitchen.newOrder(testDish(random, w * DISHES_PER_WRITER + i));
+                if (i % 500 == 499) {
+                    kitchen.releaseDishesBelowPrepTime(20);
+                }
+            }
+            writers_done++;
+        });
+    }
+    int views = 0;
+    while (writers_done < WRITERS || views == 0) {
+        std::shared_ptr<const KitchenView> view = kitchen.view();
+        checkViewIsWhole(*view);
+        ConcurrentKitchen::Snapshot snapshot = kitchen.snapshot();
+        KITCHEN_CHECK(snapshot.dish_count >= 0);
+        ++views;
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // With no writer running, the per-shard totals add up to the whole kitchen
+    kitchen.releaseDishesBelowPrepTime(20);
+    std::shared_ptr<const KitchenView> view = kitchen.view();
+    checkViewIsWhole(*view);
+    ConcurrentKitchen::Snapshot snapshot = kitchen.snapshot();
+    KITCHEN_CHECK(snapshot.dish_count == view->getCurrentSize());
+    KITCHEN_CHECK(snapshot.total_prep_time == view->stats().getPrepTimeSum());
+    KITCHEN_CHECK(snapshot.total_revenue_cents == view->stats().getRevenue().cents());
+    KITCHEN_CHECK(snapshot.elaborate_count == view->stats().getElaborateCount());
+    KITCHEN_CHECK(kitchen.stats() == view->stats());
+    view->forEachDish([](const Dish& a_dish) {
+        KITCHEN_CHECK(a_dish.getPrepTime() >= 20);
+    });
+    std::ostringstream report;
+    std::ostringstream view_report;
+    kitchen.kitchenReport(report);
+    view->kitchenReport(view_report);
+    KITCHEN_CHECK(report.str() == view_report.str());
+}
+
+} // namespace
+
+int main() {
+    testViewsWhileWriting();
+    return 0;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file IngredientArenaTest.cpp
+ * @brief This file contains the tests of a Kitchen's ingredient arena: steady-state orders and serves that allocate
+ * nothing, counted by replacing the global operator new, and `resetArena` at the end of a shift.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenInvariants.hpp"
+#include "KitchenSnapshot.hpp"
+#include "OrderLoader.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::atomic<long long> allocation_count(0);
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+namespace {
+
+/**
+ * @return A menu of dishes built outside any kitchen, so their lists are in IngredientListPool::global().
+ */
+std::vector<Dish> menu() {
+    std::mt19937 random(17);
+    std::vector<Dish> dishes;
+    for (int i = 0; i < 300; ++i) {
+        dishes.push_back(testDish(random, i));
+    }
+    return dishes;
+}
+
+void testSteadyStateAllocatesNothing() {
+    const std::vector<Dish> dishes = menu();
+    Kitchen kitchen;
+    kitchen.reserve(static_cast<int>(dishes.size()));
+    // The first round interns the menu's lists in the arena and grows every table
+    for (int round = 0; round < 3; ++round) {
+        for (const Dish& a_dish : dishes) {
+            KITCHEN_CHECK(kitchen.newOrder(a_dish));
+        }
+        KITCHEN_CHECK(kitchen.countDishesBelowPrepTime(60) >= 0);
+        for (const Dish& a_dish : dishes) {
+            KITCHEN_CHECK(kitchen.serveDish(a_dish));
+        }
+    }
+    int arena_lists = kitchen.getIngredientArena().size();
+    KITCHEN_CHECK(arena_lists > 0);
+
+    long long before = allocation_count.load();
+    for (int round = 0; round < 5; ++round) {
+        for (const Dish& a_dish : dishes) {
+            kitchen.newOrder(a_dish);
+        }
+        for (const Dish& a_dish : dishes) {
+            kitchen.serveDish(a_dish);
+        }
+    }
+    KITCHEN_CHECK(allocation_count.load() == before);
+    KITCHEN_CHECK(kitchen.getIngredientArena().size() == arena_lists);
+}
+
+void testResetArena() {
+    const std::vector<Dish> dishes = menu();
+    Kitchen kitchen;
+    for (const Dish& a_dish : dishes) {
+        kitchen.newOrder(a_dish);
+    }
+    KITCHEN_CHECK(kitchen.getIngredientArena().bytesReserved() > 0);
+    const IngredientListPool* arena = &kitchen.getIngredientArena();
+
+    // End of shift: the kitchen is empty and the arena's memory is freed
+    kitchen.resetArena();
+    KITCHEN_CHECK(kitchen.isEmpty());
+    KITCHEN_CHECK(&kitchen.getIngredientArena() == arena);
+    KITCHEN_CHECK(kitchen.getIngredientArena().size() == 0);
+    KITCHEN_CHECK(kitchen.getIngredientArena().bytesReserved() == 0);
+    checkKitchenInvariants(kitchen);
+
+    // The next shift refills it; the menu, pooled globally, is unaffected
+    for (const Dish& a_dish : dishes) {
+        KITCHEN_CHECK(kitchen.newOrder(a_dish));
+    }
+    checkKitchenInvariants(kitchen);
+    for (int slot = 0; slot < kitchen.getCurrentSize(); ++slot) {
+        KITCHEN_CHECK(kitchen.getDishAt(slot).getIngredients() == dishes[slot].getIngredients());
+    }
+}
+
+void testSharedArenaOutlivesReset() {
+    const std::vector<Dish> dishes = menu();
+    Kitchen kitchen;
+    for (const Dish& a_dish : dishes) {
+        kitchen.newOrder(a_dish);
+    }
+    std::shared_ptr<const KitchenView> view = kitchen.view();
+    Kitchen copy(kitchen);
+    KITCHEN_CHECK(&copy.getIngredientArena() == &kitchen.getIngredientArena());
+
+    // The view and the copy still use the arena, so the kitchen moves to a new one
+    const IngredientListPool* arena = &kitchen.getIngredientArena();
+    kitchen.resetArena();
+    KITCHEN_CHECK(&kitchen.getIngredientArena() != arena);
+    KITCHEN_CHECK(kitchen.getIngredientArena().size() == 0);
+    KITCHEN_CHECK(view->getCurrentSize() == static_cast<int>(dishes.size()));
+    for (int i = 0; i < view->getCurrentSize(); ++i) {
+        KITCHEN_CHECK(view->getDishAt(i).getIngredients() == dishes[i].getIngredients());
+        KITCHEN_CHECK(copy.getDishAt(i).getIngredients() == dishes[i].getIngredients());
+    }
+    checkKitchenInvariants(copy);
+
+    // A dish moved to the global pool survives its kitchen's arena
+    Dish kept = copy.getDishAt(0);
+    kept.internIngredientsIn(IngredientListPool::global());
+    copy = Kitchen();
+    view.reset();
+    KITCHEN_CHECK(kept.getIngredients() == dishes[0].getIngredients());
+}
+
+void testRestoreAndLoadUseTheArena() {
+    const std::vector<Dish> dishes = menu();
+    Kitchen kitchen;
+    std::string csv;
+    for (const Dish& a_dish : dishes) {
+        csv += a_dish.getName() + ',';
+        for (int i = 0; i < a_dish.getIngredientCount(); ++i) {
+            csv += (i > 0 ? ";" : "") + a_dish.getIngredient(i);
+        }
+        csv += ',' + std::to_string(a_dish.getPrepTime()) + ",1.50," + a_dish.getCuisineType() + '\n';
+    }
+    std::istringstream in(csv);
+    OrderLoader::Stats stats = OrderLoader().load(in, kitchen);
+    KITCHEN_CHECK(stats.added == static_cast<long long>(dishes.size()));
+    KITCHEN_CHECK(kitchen.getIngredientArena().size() > 0);
+    checkKitchenInvariants(kitchen);
+
+    std::ostringstream out;
+    KITCHEN_CHECK(kitchen.saveSnapshot(out));
+    std::string bytes = out.str();
+    std::vector<std::uint64_t> buffer((bytes.size() + 7) / 8);
+    std::memcpy(buffer.data(), bytes.data(), bytes.size());
+    KitchenSnapshotView snapshot;
+    KITCHEN_CHECK(snapshot.openBuffer(buffer.data(), bytes.size()));
+    Kitchen restored;
+    KITCHEN_CHECK(restored.restoreSnapshot(snapshot));
+    KITCHEN_CHECK(restored.getIngredientArena().size() == kitchen.getIngredientArena().size());
+    checkKitchenInvariants(restored);
+}
+
+} // namespace
+
+int main() {
+    testSteadyStateAllocatesNothing();
+    testResetArena();
+    testSharedArenaOutlivesReset();
+    testRestoreAndLoadUseTheArena();
+    return 0;
+}
@@ -0,0 +1,256 @@
+/**
+ * @file KitchenEventLogTest.cpp
+ * @brief This file contains the tests of KitchenEventLog: replaying the events of random adds, serves, releases,
+ * expiries, assignments and clears rebuilds the kitchen slot for slot, events are numbered in order with the right
+ * removal reasons, and a full ring drops its oldest events in a way readers can detect.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "Kitchen.hpp"
+#include "KitchenEventLog.hpp"
+#include "TestSupport.hpp"
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+
+typedef KitchenEventLog::Event Event;
+
+/**
+ * The kitchen as rebuilt from its events alone, by slot.
+ */
+class Replica {
+public:
+    void apply(const Event& event) {
+        switch (event.type) {
+        case KitchenEventLog::DISH_ADDED:
+            KITCHEN_CHECK(slots_.count(event.slot) == 0);
+            slots_[event.slot] = event;
+            break;
+        case KitchenEventLog::DISH_SERVED:
+        case KitchenEventLog::DISH_RELEASED:
+            KITCHEN_CHECK(slots_.count(event.slot) == 1);
+            KITCHEN_CHECK(slots_[event.slot].name_id == event.name_id);
+            slots_.erase(event.slot);
+            break;
+        case KitchenEventLog::DISH_MOVED:
+            KITCHEN_CHECK(slots_.count(event.slot) == 1 && slots_.count(event.to_slot) == 0);
+            KITCHEN_CHECK(slots_[event.slot].name_id == event.name_id);
+            slots_[event.to_slot] = slots_[event.slot];
+            slots_.erase(event.slot);
+            break;
+        case KitchenEventLog::KITCHEN_CLEARED:
+            KITCHEN_CHECK(event.slot == -1 && event.to_slot == -1);
+            slots_.clear();
+            break;
+        }
+    }
+
+    void check(const Kitchen& kitchen) const {
+        KITCHEN_CHECK(static_cast<int>(slots_.size()) == kitchen.getCurrentSize());
+        for (int slot = 0; slot < kitchen.getCurrentSize(); ++slot) {
+            std::map<int, Event>::const_iterator entry = slots_.find(slot);
+            KITCHEN_CHECK(entry != slots_.end());
+            const Dish& a_dish = kitchen.getDishAt(slot);
+            KITCHEN_CHECK(entry->second.name_id == a_dish.getNameId());
+            KITCHEN_CHECK(entry->second.prep_time == a_dish.getPrepTime());
+            KITCHEN_CHECK(entry->second.price_cents == a_dish.getPriceValue().cents());
+            KITCHEN_CHECK(entry->second.cuisineType() == a_dish.getCuisineTypeEnum());
+        }
+    }
+
+private:
+    std::map<int, Event> slots_;
+};
+
+/**
+ * @post Reads the new events in small chunks, checks their numbering and replays them.
+ * @return The events read.
+ */
+std::vector<Event> catchUp(const KitchenEventLog& log, std::uint64_t& cursor, Replica& replica) {
+    std::vector<Event> read;
+    Event chunk[3];
+    std::size_t count;
+    while ((count = log.read(cursor, chunk, 3)) > 0) {
+        for (std::size_t i = 0; i < count; ++i) {
+            KITCHEN_CHECK(chunk[i].sequence == cursor - count + i);
+            KITCHEN_CHECK(log.at(chunk[i].sequence).sequence == chunk[i].sequence);
+            replica.apply(chunk[i]);
+            read.push_back(chunk[i]);
+        }
+    }
+    KITCHEN_CHECK(cursor == log.nextSequence());
+    return read;
+}
+
+void testReplay(unsigned seed) {
+    std::mt19937 random(seed);
+    Kitchen kitchen;
+    kitchen.setOrderTtl(30);
+    KitchenEventLog log(1 << 12);
+    kitchen.addObserver(&log);
+    Replica replica;
+    std::uint64_t cursor = 0;
+    std::int64_t now = 0;
+    int next_index = 0;
+    for (int step = 0; step < 2000; ++step) {
+        int size = kitchen.getCurrentSize();
+        unsigned operation = random() % 10;
+        if (size == 0 && operation >= 3 && operation <= 6) {
+            operation = 0;
+        }
+        switch (operation) {
+        case 0:
+        case 1: {
+            KITCHEN_CHECK(kitchen.newOrder(testDish(random, next_index++)));
+            std::vector<Event> events = catchUp(log, cursor, replica);
+            KITCHEN_CHECK(events.size() == 1 && events[0].type == KitchenEventLog::DISH_ADDED);
+            KITCHEN_CHECK(events[0].slot == size && events[0].to_slot == -1);
+            break;
+        }
+        case 2: {
+            std::vector<Dish> batch;
+            for (int i = 0; i < 5; ++i) {
+                batch.push_back(testDish(random, next_index++));
+            }
+            kitchen.newOrders(batch.begin(), batch.end());
+            std::vector<Event> events = catchUp(log, cursor, replica);
+            KITCHEN_CHECK(events.size() == 5);
+            for (int i = 0; i < 5; ++i) {
+                KITCHEN_CHECK(events[i].type == KitchenEventLog::DISH_ADDED && events[i].slot == size + i);
+            }
+            break;
+        }
+        case 3: {
+            // The served dish is reported first, then the last dish moving into its slot
+            int slot = static_cast<int>(random() % size);
+            KITCHEN_CHECK(kitchen.serveDish(kitchen.getDishAt(slot)));
+            std::vector<Event> events = catchUp(log, cursor, replica);
+            KITCHEN_CHECK(!events.empty() && events[0].type == KitchenEventLog::DISH_SERVED && events[0].slot == slot);
+            KITCHEN_CHECK(events.size() == (slot == size - 1 ? 1u : 2u));
+            if (events.size() == 2) {
+                KITCHEN_CHECK(events[1].type == KitchenEventLog::DISH_MOVED);
+                KITCHEN_CHECK(events[1].slot == size - 1 && events[1].to_slot == slot);
+            }
+            break;
+        }
+        case 4:
+        case 5: {
+            int removed = operation == 4 ? kitchen.releaseDishesBelowPrepTime(static_cast<int>(random() % 20))
+                                         : kitchen.releaseDishesContaining("Basil");
+            int released = 0;
+            for (const Event& event : catchUp(log, cursor, replica)) {
+                KITCHEN_CHECK(event.type == KitchenEventLog::DISH_RELEASED || event.type == KitchenEventLog::DISH_MOVED);
+                released += event.type == KitchenEventLog::DISH_RELEASED;
+            }
+            KITCHEN_CHECK(released == removed);
+            break;
+        }
+        case 6: {
+            now += random() % 8;
+            int expired = kitchen.expireOrders(now);
+            int released = 0;
+            for (const Event& event : catchUp(log, cursor, replica)) {
+                KITCHEN_CHECK(event.type != KitchenEventLog::DISH_ADDED && event.type != KitchenEventLog::DISH_SERVED);
+                released += event.type == KitchenEventLog::DISH_RELEASED;
+            }
+            KITCHEN_CHECK(released == expired);
+            break;
+        }
+        case 7: {
+            // Assignment is reported as a clear followed by one addition per slot
+            Kitchen other;
+            for (int i = 0; i < 3; ++i) {
+                other.newOrder(testDish(random, next_index++));
+            }
+            kitchen = other;
+            std::vector<Event> events = catchUp(log, cursor, replica);
+            KITCHEN_CHECK(events.size() == 4 && events[0].type == KitchenEventLog::KITCHEN_CLEARED);
+            break;
+        }
+        case 8:
+            if (random() % 8 == 0) {
+                kitchen.clear();
+                std::vector<Event> events = catchUp(log, cursor, replica);
+                KITCHEN_CHECK(events.size() == 1 && events[0].type == KitchenEventLog::KITCHEN_CLEARED);
+            }
+            break;
+        default:
+            break;
+        }
+        catchUp(log, cursor, replica);
+        replica.check(kitchen);
+        KITCHEN_CHECK(!log.missedEvents(cursor));
+    }
+
+    // A removed observer records nothing more
+    kitchen.removeObserver(&log);
+    std::uint64_t last = log.nextSequence();
+    kitchen.newOrder(testDish(random, next_index++));
+    kitchen.clear();
+    KITCHEN_CHECK(log.nextSequence() == last);
+}
+
+void testCapacity() {
+    KitchenEventLog log(5);
+    KITCHEN_CHECK(log.capacity() == 8);
+    KITCHEN_CHECK(log.nextSequence() == 0 && log.oldestSequence() == 0);
+    Kitchen kitchen;
+    kitchen.addObserver(&log);
+    std::mt19937 random(3);
+    for (int i = 0; i < 20; ++i) {
+        kitchen.newOrder(testDish(random, i));
+    }
+
+    // The ring keeps only the newest 8 of the 20 additions
+    KITCHEN_CHECK(log.nextSequence() == 20);
+    KITCHEN_CHECK(log.oldestSequence() == 12);
+    KITCHEN_CHECK(log.missedEvents(0));
+    KITCHEN_CHECK(log.missedEvents(11));
+    KITCHEN_CHECK(!log.missedEvents(12));
+    KITCHEN_CHECK(!log.missedEvents(20));
+    std::uint64_t cursor = 0;
+    Event events[16];
+    KITCHEN_CHECK(log.read(cursor, events, 16) == 8);
+    KITCHEN_CHECK(cursor == 20);
+    for (int i = 0; i < 8; ++i) {
+        KITCHEN_CHECK(events[i].sequence == static_cast<std::uint64_t>(12 + i));
+        KITCHEN_CHECK(events[i].slot == 12 + i);
+        KITCHEN_CHECK(events[i].name_id == kitchen.getDishAt(12 + i).getNameId());
+    }
+    KITCHEN_CHECK(log.read(cursor, events, 16) == 0);
+
+    // A reader limited to fewer events than are waiting resumes where it stopped
+    cursor = 14;
+    KITCHEN_CHECK(log.read(cursor, events, 4) == 4);
+    KITCHEN_CHECK(cursor == 18 && events[0].sequence == 14);
+    KITCHEN_CHECK(log.read(cursor, events, 4) == 2);
+    KITCHEN_CHECK(cursor == 20 && events[1].sequence == 19);
+
+    // After clear sequence numbers keep counting
+    log.clear();
+    KITCHEN_CHECK(log.oldestSequence() == 20 && log.nextSequence() == 20);
+    KITCHEN_CHECK(log.missedEvents(19));
+    KITCHEN_CHECK(!log.missedEvents(20));
+    KITCHEN_CHECK(log.read(cursor, events, 16) == 0);
+    kitchen.clear();
+    KITCHEN_CHECK(kitchen.newOrder(testDish(random, 100)));
+    KITCHEN_CHECK(log.read(cursor, events, 16) == 2);
+    KITCHEN_CHECK(events[0].sequence == 20 && events[0].type == KitchenEventLog::KITCHEN_CLEARED);
+    KITCHEN_CHECK(events[1].sequence == 21 && events[1].type == KitchenEventLog::DISH_ADDED && events[1].slot == 0);
+    kitchen.removeObserver(&log);
+}
+
+} // namespace
+
+int main() {
+    for (unsigned seed = 1; seed <= 4; ++seed) {
+        testReplay(seed);
+    }
+    testCapacity();
+    return 0;
+}
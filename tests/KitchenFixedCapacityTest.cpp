@@ -0,0 +1,111 @@
+/**
+ * @file KitchenFixedCapacityTest.cpp
+ * @brief This file contains the tests of the KITCHEN_FIXED_CAPACITY build: ArrayBag holds at most DEFAULT_CAPACITY
+ * items and fills a removed slot with its last item, and a Kitchen on top of it refuses orders, reservations and
+ * snapshots beyond that capacity while keeping every invariant. It is linked with a copy of the library built with
+ * KITCHEN_FIXED_CAPACITY defined.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "ArrayBag.hpp"
+#include "Kitchen.hpp"
+#include "KitchenInvariants.hpp"
+#include "TestSupport.hpp"
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const int CAPACITY = 100;
+
+class TestBag : public ArrayBag<int> {
+public:
+    using ArrayBag<int>::DEFAULT_CAPACITY;
+};
+
+void testBag() {
+    KITCHEN_CHECK(TestBag::DEFAULT_CAPACITY == CAPACITY);
+    ArrayBag<int> bag;
+    KITCHEN_CHECK(bag.isEmpty() && bag.getCurrentSize() == 0 && bag.toVector().empty());
+    for (int i = 0; i < CAPACITY; ++i) {
+        KITCHEN_CHECK(bag.add(i % 10));
+    }
+    KITCHEN_CHECK(!bag.add(3));
+    KITCHEN_CHECK(bag.getCurrentSize() == CAPACITY && !bag.isEmpty());
+    KITCHEN_CHECK(bag.getFrequencyOf(3) == 10 && bag.getFrequencyOf(10) == 0);
+    KITCHEN_CHECK(bag.contains(9) && !bag.contains(-1));
+
+    // Removing the first 3 moves the last item, a 9, into its slot
+    KITCHEN_CHECK(bag.remove(3));
+    KITCHEN_CHECK(!bag.remove(10));
+    std::vector<int> items = bag.toVector();
+    KITCHEN_CHECK(static_cast<int>(items.size()) == CAPACITY - 1);
+    KITCHEN_CHECK(items[2] == 2 && items[3] == 9 && items[4] == 4 && items.back() == 8);
+    KITCHEN_CHECK(bag.getFrequencyOf(3) == 9);
+    KITCHEN_CHECK(bag.add(3));
+    KITCHEN_CHECK(!bag.add(3));
+
+    ArrayBag<int> copy(bag);
+    bag.clear();
+    KITCHEN_CHECK(bag.isEmpty() && !bag.contains(0));
+    KITCHEN_CHECK(copy.getCurrentSize() == CAPACITY && copy.getFrequencyOf(3) == 10);
+    KITCHEN_CHECK(bag.add(7) && bag.toVector() == std::vector<int>(1, 7));
+}
+
+void testKitchen() {
+    std::mt19937 random(11);
+    Kitchen kitchen;
+    KITCHEN_CHECK(kitchen.getCapacity() == CAPACITY);
+    KITCHEN_CHECK(kitchen.reserve(CAPACITY));
+    KITCHEN_CHECK(!kitchen.reserve(CAPACITY + 1));
+    for (int i = 0; i < CAPACITY - 2; ++i) {
+        KITCHEN_CHECK(kitchen.newOrder(testDish(random, i)));
+    }
+
+    // A batch is accepted up to the capacity and the rest is refused
+    std::vector<Dish> batch;
+    for (int i = 0; i < 4; ++i) {
+        batch.push_back(testDish(random, CAPACITY + i));
+    }
+    std::vector<bool> added = kitchen.newOrders(batch.begin(), batch.end());
+    KITCHEN_CHECK(added == std::vector<bool>({ true, true, false, false }));
+    KITCHEN_CHECK(kitchen.getCurrentSize() == CAPACITY);
+    KITCHEN_CHECK(!kitchen.newOrder(testDish(random, 2 * CAPACITY)));
+    Dish moved = testDish(random, 2 * CAPACITY + 1);
+    KITCHEN_CHECK(!kitchen.newOrder(std::move(moved)));
+    checkKitchenInvariants(kitchen);
+
+    // Serving a dish makes room for exactly one more
+    Dish served = kitchen.getDishAt(10);
+    KITCHEN_CHECK(kitchen.serveDish(served));
+    KITCHEN_CHECK(kitchen.newOrder(batch[2]));
+    KITCHEN_CHECK(!kitchen.newOrder(batch[3]));
+    KITCHEN_CHECK(kitchen.releaseDishesBelowPrepTime(60) > 0);
+    checkKitchenInvariants(kitchen);
+
+    // Copies and moves keep the dishes, and shrinking does nothing
+    std::vector<Dish> dishes = kitchen.toVector();
+    Kitchen copy(kitchen);
+    KITCHEN_CHECK(copy.toVector() == dishes);
+    checkKitchenInvariants(copy);
+    Kitchen target;
+    target = std::move(copy);
+    KITCHEN_CHECK(target.toVector() == dishes);
+    target.shrinkToFit();
+    KITCHEN_CHECK(target.getCapacity() == CAPACITY && target.toVector() == dishes);
+    checkKitchenInvariants(target);
+    kitchen.clear();
+    KITCHEN_CHECK(kitchen.isEmpty());
+    checkKitchenInvariants(kitchen);
+}
+
+} // namespace
+
+int main() {
+    testBag();
+    testKitchen();
+    return 0;
+}
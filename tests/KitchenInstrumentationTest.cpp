@@ -0,0 +1,109 @@
+/**
+ * @file KitchenInstrumentationTest.cpp
+ * @brief This file contains the test of the KITCHEN_INSTRUMENTATION counters: after a known sequence of Kitchen
+ * operations, each operation's calls, Dish comparisons and moves are exactly those the sequence makes. It is only
+ * built when the build enables KITCHEN_INSTRUMENTATION.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "Kitchen.hpp"
+#include "TestSupport.hpp"
+#include <cstdint>
+#include <sstream>
+#include <utility>
+
+namespace {
+
+typedef KitchenInstrumentation::OperationStats OperationStats;
+
+Dish orderDish(int index) {
+    return Dish(testDishName(index), { "Salt", "Rice" }, 10 * (index + 1), 5.0, Dish::OTHER);
+}
+
+std::uint64_t latencyCount(const OperationStats& stats) {
+    std::uint64_t count = 0;
+    for (std::uint64_t bucket : stats.latency_buckets) {
+        count += bucket;
+    }
+    return count;
+}
+
+void checkCalls(const KitchenInstrumentation::Snapshot& snapshot, KitchenInstrumentation::Operation operation,
+                std::uint64_t calls) {
+    const OperationStats& stats = snapshot.operations[operation];
+    KITCHEN_CHECK(stats.calls == calls);
+    KITCHEN_CHECK(latencyCount(stats) == calls);
+}
+
+void testCounts() {
+    // Without the index, a search compares the dish with every slot up to the match
+    Kitchen kitchen(false);
+    for (int i = 0; i < 5; ++i) {
+        KITCHEN_CHECK(kitchen.newOrder(orderDish(i)));
+    }
+    KITCHEN_CHECK(!kitchen.newOrder(orderDish(2)));
+    Dish moved = orderDish(5);
+    KITCHEN_CHECK(kitchen.newOrder(std::move(moved)));
+
+    KitchenInstrumentation::Snapshot snapshot = kitchen.instrumentationSnapshot();
+    checkCalls(snapshot, KitchenInstrumentation::NEW_ORDER, 7);
+    KITCHEN_CHECK(snapshot.operations[KitchenInstrumentation::NEW_ORDER].comparisons == 0 + 1 + 2 + 3 + 4 + 3 + 5);
+    KITCHEN_CHECK(snapshot.operations[KitchenInstrumentation::NEW_ORDER].moves == 6);
+    for (KitchenInstrumentation::Operation operation : { KitchenInstrumentation::SERVE_DISH,
+                                                         KitchenInstrumentation::TALLY_CUISINE_TYPES,
+                                                         KitchenInstrumentation::RELEASE,
+                                                         KitchenInstrumentation::KITCHEN_REPORT }) {
+        checkCalls(snapshot, operation, 0);
+    }
+
+    // Serving slot 1 of 6 moves the last dish into it; a dish not in the kitchen is compared with all 5 left
+    KITCHEN_CHECK(kitchen.serveDish(orderDish(1)));
+    KITCHEN_CHECK(!kitchen.serveDish(orderDish(1)));
+    KITCHEN_CHECK(kitchen.tallyCuisineTypes(Dish::OTHER) == 5);
+    KITCHEN_CHECK(kitchen.tallyCuisineTypes("OTHER") == 5);
+    KITCHEN_CHECK(kitchen.tallyCuisineTypes(Dish::ITALIAN) == 0);
+
+    // The kitchen holds preparation times 10, 60, 30, 40 and 50; each release function is one call
+    KITCHEN_CHECK(kitchen.releaseDishesBelowPrepTime(35) == 2);
+    KITCHEN_CHECK(kitchen.releaseIf([](const Dish& a_dish) { return a_dish.getPrepTime() == 40; }) == 1);
+    KITCHEN_CHECK(kitchen.releaseDishesContaining("Pepper") == 0);
+    KITCHEN_CHECK(kitchen.releaseDishesOfCuisineType("ITALIAN") == 0);
+    KITCHEN_CHECK(kitchen.expireOrders(1) == 0);
+    std::ostringstream report;
+    kitchen.kitchenReport(report);
+
+    snapshot = kitchen.instrumentationSnapshot();
+    checkCalls(snapshot, KitchenInstrumentation::NEW_ORDER, 7);
+    checkCalls(snapshot, KitchenInstrumentation::SERVE_DISH, 2);
+    KITCHEN_CHECK(snapshot.operations[KitchenInstrumentation::SERVE_DISH].comparisons == 2 + 5);
+    KITCHEN_CHECK(snapshot.operations[KitchenInstrumentation::SERVE_DISH].moves == 1);
+    checkCalls(snapshot, KitchenInstrumentation::TALLY_CUISINE_TYPES, 3);
+    checkCalls(snapshot, KitchenInstrumentation::RELEASE, 5);
+    KITCHEN_CHECK(snapshot.operations[KitchenInstrumentation::RELEASE].comparisons == 0);
+    checkCalls(snapshot, KitchenInstrumentation::KITCHEN_REPORT, 1);
+    KITCHEN_CHECK(kitchen.getCurrentSize() == 2);
+
+    std::string table;
+    snapshot.appendTo(table);
+    KITCHEN_CHECK(table.find(KitchenInstrumentation::operationName(KitchenInstrumentation::NEW_ORDER))
+                  != std::string::npos);
+
+    // A copy starts at zero, and a reset clears every counter
+    Kitchen copy(kitchen);
+    checkCalls(copy.instrumentationSnapshot(), KitchenInstrumentation::NEW_ORDER, 0);
+    kitchen.resetInstrumentation();
+    snapshot = kitchen.instrumentationSnapshot();
+    for (const OperationStats& stats : snapshot.operations) {
+        KITCHEN_CHECK(stats.calls == 0 && stats.comparisons == 0 && stats.moves == 0 && stats.total_nanoseconds == 0);
+        KITCHEN_CHECK(latencyCount(stats) == 0);
+    }
+}
+
+} // namespace
+
+int main() {
+    testCounts();
+    return 0;
+}
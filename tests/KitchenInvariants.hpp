@@ -0,0 +1,107 @@
+/**
+ * @file KitchenInvariants.hpp
+ * @brief This file contains a check that every structure a Kitchen mirrors its dishes in agrees with the dishes.
+ *
+ * `checkKitchenInvariants` recomputes, from the dishes alone, what the Kitchen keeps incrementally: the running
+ * totals, the columns, the dish index, the preparation time index and sketch, the ingredient index and the slots of
+ * the expiry wheel. Tests call it after every kind of change.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef KITCHEN_INVARIANTS_HPP
+#define KITCHEN_INVARIANTS_HPP
+
+#include "Kitchen.hpp"
+#include "TestSupport.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// KitchenBag::add and remove would bypass every structure checked here, so a Kitchen must not convert to its bag
+static_assert(!std::is_convertible<Kitchen*, KitchenBag*>::value, "Kitchen inherits KitchenBag privately");
+
+/**
+ * @param kitchen The kitchen to check.
+ * @post Exits through KITCHEN_CHECK if any mirrored structure disagrees with the kitchen's dishes.
+ */
+inline void checkKitchenInvariants(const Kitchen& kitchen) {
+    const int dish_count = kitchen.getCurrentSize();
+    const KitchenColumns& columns = kitchen.getColumns();
+    KITCHEN_CHECK(columns.size() == dish_count);
+
+    long long prep_time_sum = 0;
+    Price revenue;
+    int elaborate_count = 0;
+    std::array<int, Dish::CUISINE_TYPE_COUNT> cuisine_counts{};
+    std::vector<int> prep_times;
+    std::map<std::string, int> ingredient_counts;
+    PrepTimeSketch prep_time_sketch;
+    for (int slot = 0; slot < dish_count; ++slot) {
+        const Dish& a_dish = kitchen.getDishAt(slot);
+        bool elaborate = kitchen.getElaboratePolicy().classify(a_dish.getIngredientCount(), a_dish.getPrepTime());
+        KITCHEN_CHECK(columns.getPrepTime(slot) == a_dish.getPrepTime());
+        KITCHEN_CHECK(columns.getPriceCents(slot) == a_dish.getPriceValue().cents());
+        KITCHEN_CHECK(columns.getCuisineType(slot) == a_dish.getCuisineTypeEnum());
+        KITCHEN_CHECK(columns.getIngredientCount(slot) == a_dish.getIngredientCount());
+        KITCHEN_CHECK(columns.isElaborate(slot) == elaborate);
+        KITCHEN_CHECK(kitchen.contains(a_dish));
+        KITCHEN_CHECK(kitchen.getSlotOf(a_dish) == slot);
+        KITCHEN_CHECK(kitchen.getOrderTime(slot) <= kitchen.getCurrentTime());
+
+        prep_time_sum += a_dish.getPrepTime();
+        revenue += a_dish.getPriceValue();
+        elaborate_count += elaborate;
+        cuisine_counts[a_dish.getCuisineTypeEnum()]++;
+        prep_times.push_back(a_dish.getPrepTime());
+        prep_time_sketch.insert(a_dish.getPrepTime());
+        std::set<std::string> distinct_ingredients;
+        for (int i = 0; i < a_dish.getIngredientCount(); ++i) {
+            distinct_ingredients.insert(a_dish.getIngredient(i));
+        }
+        for (const std::string& ingredient : distinct_ingredients) {
+            ingredient_counts[ingredient]++;
+        }
+    }
+
+    KITCHEN_CHECK(kitchen.getPrepTimeSum() == prep_time_sum);
+    KITCHEN_CHECK(kitchen.totalRevenue() == revenue);
+    KITCHEN_CHECK(kitchen.elaborateDishCount() == elaborate_count);
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+        KITCHEN_CHECK(kitchen.tallyCuisineTypes(static_cast<Dish::CuisineType>(c)) == cuisine_counts[c]);
+    }
+    for (const std::pair<const std::string, int>& ingredient : ingredient_counts) {
+        KITCHEN_CHECK(kitchen.tallyIngredient(ingredient.first) == ingredient.second);
+    }
+
+    std::sort(prep_times.begin(), prep_times.end());
+    for (double percent : { 0.0, 25.0, 50.0, 90.0, 100.0 }) {
+        long long rank = static_cast<long long>(std::ceil(percent / 100.0 * dish_count));
+        int expected = dish_count == 0 ? 0 : prep_times[rank > 0 ? rank - 1 : 0];
+        KITCHEN_CHECK(kitchen.prepTimePercentile(percent) == expected);
+    }
+    for (int threshold : { 0, 30, 60, 200 }) {
+        int below = static_cast<int>(std::lower_bound(prep_times.begin(), prep_times.end(), threshold) - prep_times.begin());
+        KITCHEN_CHECK(kitchen.countDishesBelowPrepTime(threshold) == below);
+    }
+
+    KitchenStats stats = kitchen.stats();
+    KITCHEN_CHECK(stats.getDishCount() == dish_count);
+    KITCHEN_CHECK(stats.getPrepTimeSum() == prep_time_sum);
+    KITCHEN_CHECK(stats.getRevenue() == revenue);
+    KITCHEN_CHECK(stats.getElaborateCount() == elaborate_count);
+    KITCHEN_CHECK(stats.getPrepTimes() == prep_time_sketch);
+
+    KitchenColumns::Aggregates scanned = kitchen.scanAggregates();
+    KITCHEN_CHECK(scanned.dish_count == dish_count);
+    KITCHEN_CHECK(scanned.prep_time_sum == prep_time_sum);
+    KITCHEN_CHECK(scanned.elaborate_count == elaborate_count);
+}
+
+#endif
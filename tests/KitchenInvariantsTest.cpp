@@ -0,0 +1,306 @@
+/**
+ * @file KitchenInvariantsTest.cpp
+ * @brief This file contains a randomized test of every kind of Kitchen change against a plain map of its dishes: after
+ * each add, serve, release, expiry, restore, assignment and reset, the dishes match the map and every structure the
+ * kitchen mirrors them in passes checkKitchenInvariants. Dishes given cuisine types outside the enum are counted as OTHER.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenInvariants.hpp"
+#include "KitchenSnapshot.hpp"
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const char* const INGREDIENTS[] = { "Salt", "Pepper", "Garlic", "Onion", "Rice", "Basil", "Lime", "Egg" };
+
+struct Entry {
+    Dish dish;
+    std::int64_t order_time;
+};
+
+// The dishes a kitchen should hold, by name, with the time each was ordered
+typedef std::map<std::string, Entry> Model;
+
+/**
+ * Applies random operations to a kitchen and to a model of it, and checks that they agree after each one.
+ */
+class KitchenChecker {
+public:
+    explicit KitchenChecker(unsigned seed) : random_(seed), next_index_(0), ttl_(0) {}
+
+    /**
+     * @param steps The number of random operations to apply.
+     * @post Exits through KITCHEN_CHECK as soon as the kitchen and the model disagree.
+     */
+    void run(int steps) {
+        for (int step = 0; step < steps; ++step) {
+            applyRandomOperation();
+            check();
+        }
+    }
+
+private:
+    std::mt19937 random_;
+    int next_index_;
+    std::int64_t ttl_;
+    Kitchen kitchen_;
+    Model model_;
+
+    Dish newDish() {
+        return testDish(random_, next_index_++);
+    }
+
+    const Dish* randomModelDish() {
+        if (model_.empty()) {
+            return nullptr;
+        }
+        Model::iterator entry = model_.begin();
+        std::advance(entry, random_() % model_.size());
+        return &entry->second.dish;
+    }
+
+    void addToModel(const Dish& a_dish) {
+        model_[a_dish.getName()] = Entry{ a_dish, kitchen_.getCurrentTime() };
+    }
+
+    template<class Predicate>
+    int removeFromModel(Predicate pred) {
+        int removed = 0;
+        for (Model::iterator entry = model_.begin(); entry != model_.end();) {
+            if (pred(entry->second)) {
+                entry = model_.erase(entry);
+                ++removed;
+            } else {
+                ++entry;
+            }
+        }
+        return removed;
+    }
+
+    static bool hasIngredient(const Dish& a_dish, const std::string& ingredient) {
+        for (int i = 0; i < a_dish.getIngredientCount(); ++i) {
+            if (a_dish.getIngredient(i) == ingredient) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void applyRandomOperation() {
+        switch (random_() % 22) {
+            case 0: case 1: case 2: case 3: {
+                Dish a_dish = newDish();
+                KITCHEN_CHECK(kitchen_.newOrder(a_dish));
+                addToModel(a_dish);
+                const Dish* existing = randomModelDish();
+                KITCHEN_CHECK(!kitchen_.newOrder(*existing));
+                break;
+            }
+            case 4: {
+                std::vector<Dish> batch;
+                for (int i = 0; i < 6; ++i) {
+                    batch.push_back(newDish());
+                }
+                batch.push_back(batch[2]);
+                std::vector<bool> added = kitchen_.newOrders(batch.begin(), batch.end());
+                for (int i = 0; i < 6; ++i) {
+                    KITCHEN_CHECK(added[i]);
+                    addToModel(batch[i]);
+                }
+                KITCHEN_CHECK(!added[6]);
+                break;
+            }
+            case 5: case 6: {
+                if (const Dish* existing = randomModelDish()) {
+                    Dish a_dish = *existing;
+                    KITCHEN_CHECK(kitchen_.serveDish(a_dish));
+                    model_.erase(a_dish.getName());
+                }
+                KITCHEN_CHECK(!kitchen_.serveDish(newDish()));
+                break;
+            }
+            case 7: {
+                std::vector<Dish> batch;
+                for (int i = 0; i < 3 && !model_.empty(); ++i) {
+                    batch.push_back(*randomModelDish());
+                }
+                batch.push_back(newDish());
+                std::vector<bool> served = kitchen_.serveDishes(batch.begin(), batch.end());
+                for (std::size_t i = 0; i < batch.size(); ++i) {
+                    KITCHEN_CHECK(served[i] == (model_.erase(batch[i].getName()) > 0));
+                }
+                break;
+            }
+            case 8: {
+                int threshold = static_cast<int>(random_() % 30);
+                int expected = removeFromModel([threshold](const Entry& entry) {
+                    return entry.dish.getPrepTime() < threshold;
+                });
+                KITCHEN_CHECK(kitchen_.releaseDishesBelowPrepTime(threshold) == expected);
+                break;
+            }
+            case 9: {
+                Dish::CuisineType cuisine_type = static_cast<Dish::CuisineType>(random_() % Dish::CUISINE_TYPE_COUNT);
+                int expected = removeFromModel([cuisine_type](const Entry& entry) {
+                    return entry.dish.getCuisineTypeEnum() == cuisine_type;
+                });
+                std::string name(Dish::CUISINE_TYPE_NAMES[cuisine_type]);
+                KITCHEN_CHECK(kitchen_.releaseDishesOfCuisineType(name) == expected);
+                break;
+            }
+            case 10: {
+                std::string ingredient = INGREDIENTS[random_() % 8];
+                int expected = removeFromModel([&ingredient](const Entry& entry) {
+                    return hasIngredient(entry.dish, ingredient);
+                });
+                KITCHEN_CHECK(kitchen_.releaseDishesContaining(ingredient) == expected);
+                break;
+            }
+            case 11: {
+                std::vector<std::string> ingredients = { INGREDIENTS[random_() % 8], INGREDIENTS[random_() % 8] };
+                int expected = removeFromModel([&ingredients](const Entry& entry) {
+                    return hasIngredient(entry.dish, ingredients[0]) || hasIngredient(entry.dish, ingredients[1]);
+                });
+                KITCHEN_CHECK(kitchen_.releaseDishesContainingAny(ingredients) == expected);
+                break;
+            }
+            case 12: {
+                int modulus = 2 + static_cast<int>(random_() % 5);
+                auto pred = [modulus](const Dish& a_dish) { return a_dish.getPriceValue().cents() % modulus == 0; };
+                int expected = removeFromModel([&pred](const Entry& entry) { return pred(entry.dish); });
+                int removed = (random_() % 2) ? kitchen_.releaseIf(pred) : kitchen_.parallelReleaseIf(pred);
+                KITCHEN_CHECK(removed == expected);
+                break;
+            }
+            case 13: {
+                ttl_ = (random_() % 3 == 0) ? 0 : static_cast<std::int64_t>(random_() % 200);
+                kitchen_.setOrderTtl(ttl_);
+                break;
+            }
+            case 14: case 15: {
+                // Mostly short steps, sometimes a jump over several levels of the expiry wheel
+                std::int64_t step = (random_() % 8 == 0) ? static_cast<std::int64_t>(random_() % 300000)
+                                                         : static_cast<std::int64_t>(random_() % 40);
+                std::int64_t now = kitchen_.getCurrentTime() + step;
+                std::int64_t ttl = ttl_;
+                int expected = (ttl <= 0) ? 0 : removeFromModel([now, ttl](const Entry& entry) {
+                    return entry.order_time + ttl <= now;
+                });
+                KITCHEN_CHECK(kitchen_.expireOrders(now) == expected);
+                KITCHEN_CHECK(kitchen_.getCurrentTime() == now);
+                break;
+            }
+            case 16: {
+                ElaboratePolicy policy(1 + static_cast<int>(random_() % 5), static_cast<int>(random_() % 90));
+                kitchen_.setElaboratePolicy(policy);
+                break;
+            }
+            case 17: {
+                // Copy assignment, then move assignment back
+                Kitchen copy;
+                copy.newOrder(newDish());
+                copy = kitchen_;
+                checkKitchenInvariants(copy);
+                kitchen_ = std::move(copy);
+                break;
+            }
+            case 18: {
+                std::ostringstream out;
+                KITCHEN_CHECK(kitchen_.saveSnapshot(out));
+                std::string bytes = out.str();
+                std::vector<std::uint64_t> buffer((bytes.size() + 7) / 8);
+                std::memcpy(buffer.data(), bytes.data(), bytes.size());
+                KitchenSnapshotView snapshot;
+                KITCHEN_CHECK(snapshot.openBuffer(buffer.data(), bytes.size()));
+                KITCHEN_CHECK(kitchen_.restoreSnapshot(snapshot));
+                // Restored dishes are ordered at the kitchen clock
+                for (std::pair<const std::string, Entry>& entry : model_) {
+                    entry.second.order_time = kitchen_.getCurrentTime();
+                }
+                break;
+            }
+            case 19: {
+                std::shared_ptr<const KitchenView> view = kitchen_.view();
+                KITCHEN_CHECK(view->getCurrentSize() == kitchen_.getCurrentSize());
+                KITCHEN_CHECK(view->stats() == kitchen_.stats());
+                for (int slot = 0; slot < view->getCurrentSize(); ++slot) {
+                    KITCHEN_CHECK(view->getDishAt(slot) == kitchen_.getDishAt(slot));
+                }
+                break;
+            }
+            case 20: {
+                kitchen_.setDishIndexEnabled(!kitchen_.isDishIndexEnabled());
+                break;
+            }
+            default: {
+                if (random_() % 10 == 0) {
+                    if (random_() % 2) {
+                        kitchen_.clear();
+                    } else {
+                        kitchen_.resetArena();
+                    }
+                    model_.clear();
+                }
+                break;
+            }
+        }
+    }
+
+    void check() {
+        KITCHEN_CHECK(kitchen_.getCurrentSize() == static_cast<int>(model_.size()));
+        for (int slot = 0; slot < kitchen_.getCurrentSize(); ++slot) {
+            const Dish& a_dish = kitchen_.getDishAt(slot);
+            Model::const_iterator entry = model_.find(a_dish.getName());
+            KITCHEN_CHECK(entry != model_.end());
+            KITCHEN_CHECK(entry->second.dish == a_dish);
+            KITCHEN_CHECK(kitchen_.getOrderTime(slot) == entry->second.order_time);
+        }
+        checkKitchenInvariants(kitchen_);
+    }
+};
+
+void testOutOfRangeCuisineTypes() {
+    const Dish::CuisineType TOO_LARGE = static_cast<Dish::CuisineType>(Dish::CUISINE_TYPE_COUNT + 35);
+    const Dish::CuisineType NEGATIVE = static_cast<Dish::CuisineType>(-1);
+    Dish built("Dish a", { "Salt" }, 10, 1.0, TOO_LARGE);
+    KITCHEN_CHECK(built.getCuisineTypeEnum() == Dish::OTHER);
+    Dish set("Dish b", { "Salt" }, 10, 1.0, Dish::ITALIAN);
+    set.setCuisineType(NEGATIVE);
+    KITCHEN_CHECK(set.getCuisineTypeEnum() == Dish::OTHER);
+    std::string_view ingredient = "Salt";
+    Dish from_fields = Dish::fromFields("Dish c", &ingredient, 1, 10, Price(), TOO_LARGE);
+    KITCHEN_CHECK(from_fields.getCuisineTypeEnum() == Dish::OTHER);
+
+    Kitchen kitchen;
+    KITCHEN_CHECK(kitchen.newOrder(built));
+    KITCHEN_CHECK(kitchen.newOrder(set));
+    KITCHEN_CHECK(kitchen.newOrder(from_fields));
+    KITCHEN_CHECK(kitchen.tallyCuisineTypes(Dish::OTHER) == 3);
+    KITCHEN_CHECK(kitchen.tallyCuisineTypes(TOO_LARGE) == 0);
+    KITCHEN_CHECK(kitchen.tallyCuisineTypes(NEGATIVE) == 0);
+    KITCHEN_CHECK(kitchen.stats().getCuisineCount(TOO_LARGE) == 0);
+    checkKitchenInvariants(kitchen);
+}
+
+} // namespace
+
+int main() {
+    // Small parallel thresholds so parallelReleaseIf and the parallel compaction run on these kitchens too
+    KitchenParallel::setSerialThreshold(64);
+    for (unsigned seed = 1; seed <= 8; ++seed) {
+        KitchenChecker(seed).run(1500);
+    }
+    testOutOfRangeCuisineTypes();
+    return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file KitchenKernelsTest.cpp
+ * @brief This file contains the tests of KitchenKernels: every instruction set gives the scalar results, including
+ * for bytes outside the histogram's buckets, and the instruction set can be switched while kernels run on other threads.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenKernels.hpp"
+#include "TestSupport.hpp"
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const KitchenKernels::Isa ISAS[] = { KitchenKernels::SCALAR, KitchenKernels::SSE2, KitchenKernels::AVX2 };
+
+void testIsasAgree() {
+    std::mt19937 random(9);
+    for (int count : { 0, 1, 15, 31, 32, 33, 1000 }) {
+        std::vector<int> prep_times(count);
+        std::vector<std::uint8_t> bytes(count);
+        for (int i = 0; i < count; ++i) {
+            prep_times[i] = static_cast<int>(random() % 200) - 20;
+            bytes[i] = static_cast<std::uint8_t>(random() % 8);
+        }
+        int expected_below = 0;
+        std::vector<int> expected_counts(6, 0);
+        for (int i = 0; i < count; ++i) {
+            expected_below += prep_times[i] < 60;
+            if (bytes[i] < 6) {
+                expected_counts[bytes[i]]++;
+            }
+        }
+        for (KitchenKernels::Isa isa : ISAS) {
+            KitchenKernels::forceIsa(isa);
+            KITCHEN_CHECK(KitchenKernels::activeIsa() <= isa);
+            KITCHEN_CHECK(KitchenKernels::countPrepTimeBelow(prep_times.data(), count, 60) == expected_below);
+            std::vector<std::uint8_t> mask(count, 7);
+            KITCHEN_CHECK(KitchenKernels::markPrepTimeBelow(prep_times.data(), count, 60, mask.data())
+                          == expected_below);
+            for (int i = 0; i < count; ++i) {
+                KITCHEN_CHECK((mask[i] != 0) == (prep_times[i] < 60));
+            }
+            std::vector<int> counts(6, -1);
+            KitchenKernels::byteHistogram(bytes.data(), count, counts.data(), 6);
+            KITCHEN_CHECK(counts == expected_counts);
+        }
+    }
+    KitchenKernels::forceIsa(KitchenKernels::detectIsa());
+    KITCHEN_CHECK(KitchenKernels::activeIsa() == KitchenKernels::detectIsa());
+}
+
+void testSwitchWhileRunning() {
+    std::vector<int> prep_times(4096);
+    int expected_below = 0;
+    for (int i = 0; i < 4096; ++i) {
+        prep_times[i] = i % 100;
+        expected_below += prep_times[i] < 50;
+    }
+    std::atomic<bool> done{false};
+    std::thread scanner([&prep_times, &done, expected_below]() {
+        while (!done) {
+            KITCHEN_CHECK(KitchenKernels::countPrepTimeBelow(prep_times.data(), 4096, 50) == expected_below);
+        }
+    });
+    for (int i = 0; i < 3000; ++i) {
+        KitchenKernels::forceIsa(ISAS[i % 3]);
+    }
+    done = true;
+    scanner.join();
+    KitchenKernels::forceIsa(KitchenKernels::detectIsa());
+}
+
+} // namespace
+
+int main() {
+    testIsasAgree();
+    testSwitchWhileRunning();
+    return 0;
+}
@@ -0,0 +1,171 @@
+/**
+ * @file KitchenObserverTest.cpp
+ * @brief This file contains the tests of KitchenObserver notifications: an observer that mirrors a kitchen from its
+ * callbacks alone must agree with the kitchen after every kind of change, including assignment.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenInvariants.hpp"
+#include "KitchenObserver.hpp"
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * Rebuilds the slots of a kitchen from its notifications.
+ */
+class MirroringObserver : public KitchenObserver {
+public:
+    void dishAdded(const Dish& a_dish, int slot) override {
+        KITCHEN_CHECK(slots_.count(slot) == 0);
+        slots_[slot] = a_dish;
+    }
+    void dishRemoved(const Dish& a_dish, int slot, RemovalReason reason) override {
+        (void)reason;
+        KITCHEN_CHECK(slots_.count(slot) == 1 && slots_[slot] == a_dish);
+        slots_.erase(slot);
+    }
+    void dishMoved(const Dish& a_dish, int from_slot, int to_slot) override {
+        KITCHEN_CHECK(slots_.count(from_slot) == 1 && slots_[from_slot] == a_dish);
+        KITCHEN_CHECK(slots_.count(to_slot) == 0);
+        slots_.erase(from_slot);
+        slots_[to_slot] = a_dish;
+    }
+    void kitchenCleared() override {
+        slots_.clear();
+        clear_count_++;
+    }
+
+    /**
+     * @param kitchen The kitchen observed.
+     * @post Exits through KITCHEN_CHECK unless the mirror holds exactly the kitchen's dishes, slot for slot.
+     */
+    void checkMirrors(const Kitchen& kitchen) const {
+        KITCHEN_CHECK(static_cast<int>(slots_.size()) == kitchen.getCurrentSize());
+        for (const std::pair<const int, Dish>& slot : slots_) {
+            KITCHEN_CHECK(slot.first < kitchen.getCurrentSize());
+            KITCHEN_CHECK(kitchen.getDishAt(slot.first) == slot.second);
+        }
+    }
+
+    int clearCount() const { return clear_count_; }
+
+private:
+    std::map<int, Dish> slots_;
+    int clear_count_ = 0;
+};
+
+/**
+ * @param first The index of the first dish.
+ * @param count The number of dishes.
+ * @return A kitchen with `count` generated dishes.
+ */
+Kitchen kitchenOf(int first, int count) {
+    std::mt19937 random(first);
+    Kitchen kitchen;
+    for (int i = first; i < first + count; ++i) {
+        kitchen.newOrder(testDish(random, i));
+    }
+    return kitchen;
+}
+
+void testChanges() {
+    std::mt19937 random(14);
+    Kitchen kitchen;
+    MirroringObserver observer;
+    kitchen.addObserver(&observer);
+    std::vector<Dish> dishes;
+    for (int i = 0; i < 400; ++i) {
+        dishes.push_back(testDish(random, i));
+    }
+    kitchen.newOrders(dishes.begin(), dishes.begin() + 300);
+    for (int i = 300; i < 400; ++i) {
+        kitchen.newOrder(dishes[i]);
+    }
+    observer.checkMirrors(kitchen);
+    for (int i = 0; i < 400; i += 3) {
+        kitchen.serveDish(dishes[i]);
+    }
+    observer.checkMirrors(kitchen);
+    kitchen.releaseDishesBelowPrepTime(30);
+    observer.checkMirrors(kitchen);
+    kitchen.releaseDishesContaining("Garlic");
+    observer.checkMirrors(kitchen);
+    checkKitchenInvariants(kitchen);
+    kitchen.clear();
+    observer.checkMirrors(kitchen);
+    kitchen.removeObserver(&observer);
+}
+
+void testAssignment() {
+    Kitchen kitchen = kitchenOf(0, 200);
+    MirroringObserver observer;
+    kitchen.addObserver(&observer);
+    kitchen.newOrder(Dish("Observed Dish", { "Salt" }, 5, 1.0, Dish::OTHER));
+    KITCHEN_CHECK(kitchen.getCurrentSize() == 201);
+
+    // Copy assignment: the observer, which saw only the last dish, sees the old contents cleared and the new ones
+    // added
+    int clear_count = observer.clearCount();
+    const Kitchen other = kitchenOf(1000, 300);
+    kitchen = other;
+    KITCHEN_CHECK(observer.clearCount() == clear_count + 1);
+    observer.checkMirrors(kitchen);
+    checkKitchenInvariants(kitchen);
+    KITCHEN_CHECK(kitchen.getCurrentSize() == other.getCurrentSize());
+    checkKitchenInvariants(other);
+
+    // The observer stays registered with the assigned-to kitchen and follows later changes
+    kitchen.serveDish(other.getDishAt(0));
+    kitchen.releaseDishesBelowPrepTime(60);
+    observer.checkMirrors(kitchen);
+    checkKitchenInvariants(kitchen);
+
+    // Move assignment
+    kitchen = kitchenOf(5000, 150);
+    KITCHEN_CHECK(observer.clearCount() == clear_count + 2);
+    observer.checkMirrors(kitchen);
+    checkKitchenInvariants(kitchen);
+
+    // Assigning an empty kitchen reports only the clear
+    kitchen = Kitchen();
+    observer.checkMirrors(kitchen);
+    checkKitchenInvariants(kitchen);
+
+    // Self-assignment changes nothing and notifies nobody
+    kitchen = kitchenOf(7000, 50);
+    int self_clear_count = observer.clearCount();
+    const Kitchen& same = kitchen;
+    kitchen = same;
+    KITCHEN_CHECK(observer.clearCount() == self_clear_count);
+    observer.checkMirrors(kitchen);
+    checkKitchenInvariants(kitchen);
+    kitchen.removeObserver(&observer);
+}
+
+void testCopyHasNoObservers() {
+    Kitchen kitchen = kitchenOf(0, 20);
+    MirroringObserver observer;
+    kitchen.addObserver(&observer);
+    observer.kitchenCleared();
+    int clear_count = observer.clearCount();
+    Kitchen copy(kitchen);
+    copy.clear();
+    copy.newOrder(Dish("Unobserved Dish", {}, 1, 1.0, Dish::OTHER));
+    KITCHEN_CHECK(observer.clearCount() == clear_count);
+    checkKitchenInvariants(copy);
+    kitchen.removeObserver(&observer);
+}
+
+} // namespace
+
+int main() {
+    testChanges();
+    testAssignment();
+    testCopyHasNoObservers();
+    return 0;
+}
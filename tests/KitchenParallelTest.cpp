@@ -0,0 +1,157 @@
+/**
+ * @file KitchenParallelTest.cpp
+ * @brief This file contains the tests of KitchenParallel: every slot is given to exactly one worker, the worker pool
+ * is reused and shared safely, and the parallel scans and compactions of a Kitchen match the serial ones.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenInvariants.hpp"
+#include "KitchenParallel.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @post Checks that one forEachChunk call visits every slot once, each from the worker whose chunk holds it.
+ */
+void checkChunks(int slot_count, int worker_count) {
+    std::vector<int> visits(slot_count, 0);
+    std::vector<int> workers(slot_count, -1);
+    std::vector<std::atomic<int>> worker_calls(worker_count);
+    KitchenParallel::forEachChunk(slot_count, worker_count, [&](int worker, int begin, int end) {
+        worker_calls[worker]++;
+        for (int slot = begin; slot < end; ++slot) {
+            visits[slot]++;
+            workers[slot] = worker;
+        }
+    });
+    for (int worker = 0; worker < worker_count; ++worker) {
+        KITCHEN_CHECK(worker_calls[worker] == 1);
+        for (int slot = KitchenParallel::chunkBegin(slot_count, worker_count, worker);
+             slot < KitchenParallel::chunkBegin(slot_count, worker_count, worker + 1); ++slot) {
+            KITCHEN_CHECK(workers[slot] == worker);
+        }
+    }
+    for (int slot = 0; slot < slot_count; ++slot) {
+        KITCHEN_CHECK(visits[slot] == 1);
+    }
+}
+
+void testForEachChunk() {
+    const int SLOT_COUNTS[] = { 0, 1, 7, 1000 };
+    for (int repeat = 0; repeat < 20; ++repeat) {
+        for (int worker_count = 1; worker_count <= 8; ++worker_count) {
+            for (int slot_count : SLOT_COUNTS) {
+                checkChunks(slot_count, worker_count);
+            }
+        }
+        // Fewer workers after more, so some pool workers sit a scan out
+        checkChunks(1000, 8);
+        checkChunks(1000, 2);
+    }
+}
+
+void testConcurrentAndNestedScans() {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; ++t) {
+        threads.emplace_back([t]() {
+            for (int repeat = 0; repeat < 100; ++repeat) {
+                checkChunks(500 + t, 2 + t);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::atomic<int> inner_slots{0};
+    KitchenParallel::forEachChunk(4, 4, [&inner_slots](int, int begin, int end) {
+        for (int slot = begin; slot < end; ++slot) {
+            KitchenParallel::forEachChunk(100, 3, [&inner_slots](int, int inner_begin, int inner_end) {
+                inner_slots += inner_end - inner_begin;
+            });
+        }
+    });
+    KITCHEN_CHECK(inner_slots == 400);
+}
+
+/**
+ * @return true if both kitchens hold equal dishes in the same order with the same statistics.
+ */
+bool sameKitchen(const Kitchen& a, const Kitchen& b) {
+    if (a.getCurrentSize() != b.getCurrentSize() || a.stats() != b.stats()) {
+        return false;
+    }
+    for (int slot = 0; slot < a.getCurrentSize(); ++slot) {
+        if (!(a.getDishAt(slot) == b.getDishAt(slot))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @post Runs `release` on a copy of the kitchen with serial scans and on another with parallel scans, and checks
+ * that both remove the same dishes and keep every mirrored structure consistent.
+ */
+template<class Release>
+void checkSerialMatchesParallel(Kitchen& kitchen, Release release) {
+    Kitchen serial_kitchen(kitchen);
+    KitchenParallel::setMaxWorkers(1);
+    int serial_removed = release(serial_kitchen);
+    KitchenParallel::setMaxWorkers(4);
+    int parallel_removed = release(kitchen);
+    KITCHEN_CHECK(serial_removed == parallel_removed);
+    KITCHEN_CHECK(sameKitchen(serial_kitchen, kitchen));
+    checkKitchenInvariants(kitchen);
+}
+
+void testKitchenScans() {
+    // Enough dishes for 4 workers of KitchenParallel::MIN_SLOTS_PER_WORKER slots each
+    const int DISH_COUNT = 4 * KitchenParallel::MIN_SLOTS_PER_WORKER + 123;
+    KitchenParallel::setSerialThreshold(1);
+    KitchenParallel::setMaxWorkers(4);
+    KITCHEN_CHECK(KitchenParallel::workerCount(DISH_COUNT) == 4);
+
+    std::mt19937 random(27);
+    Kitchen kitchen;
+    std::vector<Dish> dishes;
+    for (int i = 0; i < DISH_COUNT; ++i) {
+        dishes.push_back(testDish(random, i));
+    }
+    kitchen.newOrders(dishes.begin(), dishes.end());
+
+    KitchenColumns::Aggregates scanned = kitchen.scanAggregates();
+    KITCHEN_CHECK(scanned.dish_count == kitchen.getCurrentSize());
+    KITCHEN_CHECK(scanned.prep_time_sum == kitchen.stats().getPrepTimeSum());
+    KITCHEN_CHECK(scanned.price_cents_sum == kitchen.totalRevenue().cents());
+    KITCHEN_CHECK(scanned.elaborate_count == kitchen.elaborateDishCount());
+
+    checkSerialMatchesParallel(kitchen, [](Kitchen& k) {
+        return k.parallelReleaseIf([](const Dish& a_dish) { return a_dish.getPrepTime() % 7 == 3; });
+    });
+    checkSerialMatchesParallel(kitchen, [](Kitchen& k) { return k.releaseDishesContaining("Basil"); });
+    checkSerialMatchesParallel(kitchen, [](Kitchen& k) { return k.releaseDishesBelowPrepTime(10); });
+    checkSerialMatchesParallel(kitchen, [](Kitchen& k) {
+        return k.parallelReleaseIf([](const Dish& a_dish) { return a_dish.getPriceValue().cents() > 9000; });
+    });
+    checkSerialMatchesParallel(kitchen, [](Kitchen& k) {
+        return k.parallelReleaseIf([](const Dish&) { return false; });
+    });
+    KITCHEN_CHECK(kitchen.getCurrentSize() > KitchenParallel::MIN_SLOTS_PER_WORKER);
+
+    KitchenParallel::setSerialThreshold(KitchenParallel::DEFAULT_SERIAL_THRESHOLD);
+}
+
+} // namespace
+
+int main() {
+    testForEachChunk();
+    testConcurrentAndNestedScans();
+    testKitchenScans();
+    return 0;
+}
@@ -0,0 +1,268 @@
+/**
+ * @file KitchenSchedulerTest.cpp
+ * @brief This file contains a randomized test of KitchenScheduler against a plain map of priorities: after every
+ * Kitchen operation, including serveDish, the release functions and expireOrders, the scheduler holds exactly the
+ * kitchen's dishes with their priorities, nextDish is the lowest one, and serving them all comes out in heap order.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenScheduler.hpp"
+#include "TestSupport.hpp"
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Scheduled {
+    long long priority;
+    std::uint64_t arrival;
+};
+
+/**
+ * The scheduler's expected state, keyed by dish name.
+ */
+struct SchedulerModel {
+    KitchenScheduler::Policy policy;
+    std::map<std::string, Scheduled> dishes;
+    std::uint64_t next_arrival = 0;
+
+    void added(const Dish& a_dish) {
+        long long priority = policy == KitchenScheduler::SHORTEST_PREP_FIRST ? a_dish.getPrepTime()
+                                                                              : KitchenScheduler::NO_DEADLINE;
+        dishes[a_dish.getName()] = Scheduled{ priority, next_arrival++ };
+    }
+
+    // Forgets the dishes the kitchen no longer holds
+    void keepOnly(const Kitchen& kitchen) {
+        std::map<std::string, Scheduled> kept;
+        for (int slot = 0; slot < kitchen.getCurrentSize(); ++slot) {
+            const std::string& name = kitchen.getDishAt(slot).getName();
+            KITCHEN_CHECK(dishes.count(name) == 1);
+            kept[name] = dishes[name];
+        }
+        dishes.swap(kept);
+    }
+
+    // Empty if no dish is scheduled
+    std::string next() const {
+        std::string best;
+        const Scheduled* best_entry = nullptr;
+        for (const auto& dish : dishes) {
+            const Scheduled& entry = dish.second;
+            if (best_entry == nullptr || entry.priority < best_entry->priority
+                || (entry.priority == best_entry->priority && entry.arrival < best_entry->arrival)) {
+                best = dish.first;
+                best_entry = &entry;
+            }
+        }
+        return best;
+    }
+};
+
+void checkScheduler(const Kitchen& kitchen, const KitchenScheduler& scheduler, const SchedulerModel& model) {
+    KITCHEN_CHECK(scheduler.size() == kitchen.getCurrentSize());
+    KITCHEN_CHECK(static_cast<int>(model.dishes.size()) == kitchen.getCurrentSize());
+    for (int slot = 0; slot < kitchen.getCurrentSize(); ++slot) {
+        const Dish& a_dish = kitchen.getDishAt(slot);
+        auto found = model.dishes.find(a_dish.getName());
+        KITCHEN_CHECK(found != model.dishes.end());
+        KITCHEN_CHECK(scheduler.getPriority(a_dish) == found->second.priority);
+    }
+    const Dish* next = scheduler.nextDish();
+    if (model.dishes.empty()) {
+        KITCHEN_CHECK(next == nullptr);
+    } else {
+        KITCHEN_CHECK(next != nullptr && next->getName() == model.next());
+    }
+}
+
+// Serves every dish through the scheduler and checks they come out in (priority, arrival) order
+void checkServeOrder(Kitchen& kitchen, KitchenScheduler& scheduler, SchedulerModel& model) {
+    while (!model.dishes.empty()) {
+        std::string expected = model.next();
+        KITCHEN_CHECK(scheduler.nextDish()->getName() == expected);
+        KITCHEN_CHECK(scheduler.serveNext());
+        model.dishes.erase(expected);
+        KITCHEN_CHECK(scheduler.size() == static_cast<int>(model.dishes.size()));
+        KITCHEN_CHECK(kitchen.getCurrentSize() == scheduler.size());
+    }
+    KITCHEN_CHECK(scheduler.nextDish() == nullptr);
+    KITCHEN_CHECK(!scheduler.serveNext());
+}
+
+void testRandomOperations(unsigned seed, KitchenScheduler::Policy policy) {
+    std::mt19937 random(seed);
+    Kitchen kitchen(seed % 2 == 0);
+    kitchen.setOrderTtl(40);
+    SchedulerModel model{ policy, {} };
+    int next_index = 0;
+
+    // Dishes already in the kitchen are scheduled in slot order
+    for (int i = 0; i < 20; ++i) {
+        kitchen.newOrder(testDish(random, next_index++));
+    }
+    KitchenScheduler scheduler(kitchen, policy);
+    for (int slot = 0; slot < kitchen.getCurrentSize(); ++slot) {
+        model.added(kitchen.getDishAt(slot));
+    }
+    checkScheduler(kitchen, scheduler, model);
+
+    std::int64_t now = 0;
+    for (int step = 0; step < 1500; ++step) {
+        int size = kitchen.getCurrentSize();
+        unsigned operation = random() % 14;
+        if (size == 0 && operation >= 4) {
+            operation = 0;
+        }
+        switch (operation) {
+        case 0:
+        case 1: {
+            Dish a_dish = testDish(random, next_index++);
+            KITCHEN_CHECK(kitchen.newOrder(a_dish));
+            model.added(a_dish);
+            break;
+        }
+        case 2: {
+            std::vector<Dish> batch;
+            for (int i = 0; i < 4; ++i) {
+                batch.push_back(testDish(random, next_index++));
+            }
+            batch.push_back(batch[1]);
+            std::vector<bool> accepted = kitchen.newOrders(batch.begin(), batch.end());
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                KITCHEN_CHECK(accepted[i] == (i != 4));
+                if (accepted[i]) {
+                    model.added(batch[i]);
+                }
+            }
+            break;
+        }
+        case 3:
+            now += random() % 6;
+            kitchen.expireOrders(now);
+            break;
+        case 4: {
+            Dish a_dish = kitchen.getDishAt(random() % size);
+            KITCHEN_CHECK(kitchen.serveDish(a_dish));
+            break;
+        }
+        case 5: {
+            std::string expected = model.next();
+            KITCHEN_CHECK(scheduler.serveNext());
+            KITCHEN_CHECK(model.dishes.count(expected) == 1);
+            model.dishes.erase(expected);
+            KITCHEN_CHECK(kitchen.getCurrentSize() == size - 1);
+            break;
+        }
+        case 6:
+        case 7: {
+            const Dish& a_dish = kitchen.getDishAt(random() % size);
+            long long ready_by = static_cast<long long>(random() % 200);
+            KITCHEN_CHECK(operation == 6 ? scheduler.setDeadline(a_dish, ready_by) : scheduler.setPriority(a_dish, ready_by));
+            model.dishes[a_dish.getName()].priority = ready_by;
+            break;
+        }
+        case 8: {
+            const Dish& a_dish = kitchen.getDishAt(random() % size);
+            Scheduled& entry = model.dishes[a_dish.getName()];
+            long long priority = entry.priority == KitchenScheduler::NO_DEADLINE
+                                     ? static_cast<long long>(random() % 200)
+                                     : entry.priority - 10 + static_cast<long long>(random() % 20);
+            bool moved_forward = priority < entry.priority;
+            KITCHEN_CHECK(scheduler.bump(a_dish, priority) == moved_forward);
+            if (moved_forward) {
+                entry.priority = priority;
+            }
+            break;
+        }
+        case 9:
+            kitchen.releaseDishesBelowPrepTime(static_cast<int>(random() % 15));
+            break;
+        case 10:
+            kitchen.releaseDishesOfCuisineType(
+                std::string(Dish::cuisineTypeName(static_cast<Dish::CuisineType>(random() % Dish::CUISINE_TYPE_COUNT))));
+            break;
+        case 11:
+            if (random() % 2 == 0) {
+                kitchen.releaseDishesContaining("Garlic");
+            } else {
+                kitchen.releaseDishesContainingAny({ "Lime", "Egg" });
+            }
+            break;
+        case 12: {
+            int modulus = 5 + static_cast<int>(random() % 10);
+            kitchen.releaseIf([modulus](const Dish& a_dish) { return a_dish.getPrepTime() % modulus == 0; });
+            break;
+        }
+        default: {
+            std::vector<Dish> served;
+            for (int i = 0; i < 3; ++i) {
+                served.push_back(kitchen.getDishAt(random() % size));
+            }
+            kitchen.serveDishes(served.begin(), served.end());
+            break;
+        }
+        }
+        model.keepOnly(kitchen);
+        checkScheduler(kitchen, scheduler, model);
+
+        // Now and then the heap is emptied by serving every dish, and again by a clear
+        if (step % 500 == 499) {
+            checkServeOrder(kitchen, scheduler, model);
+            for (int i = 0; i < 10; ++i) {
+                Dish a_dish = testDish(random, next_index++);
+                kitchen.newOrder(a_dish);
+                model.added(a_dish);
+            }
+            kitchen.clear();
+            model.dishes.clear();
+            checkScheduler(kitchen, scheduler, model);
+        }
+    }
+    checkServeOrder(kitchen, scheduler, model);
+}
+
+void testDishNotInKitchen() {
+    Kitchen kitchen;
+    KitchenScheduler scheduler(kitchen, KitchenScheduler::EARLIEST_DEADLINE_FIRST);
+    std::mt19937 random(7);
+    Dish stranger = testDish(random, 1);
+    KITCHEN_CHECK(scheduler.nextDish() == nullptr);
+    KITCHEN_CHECK(!scheduler.serveNext());
+    KITCHEN_CHECK(!scheduler.setDeadline(stranger, 5));
+    KITCHEN_CHECK(!scheduler.bump(stranger, 5));
+    KITCHEN_CHECK(scheduler.getPriority(stranger) == KitchenScheduler::NO_DEADLINE);
+
+    // Orders without a deadline go after those with one, in arrival order
+    Dish first = testDish(random, 2);
+    Dish second = testDish(random, 3);
+    Dish third = testDish(random, 4);
+    kitchen.newOrder(first);
+    kitchen.newOrder(second);
+    kitchen.newOrder(third);
+    KITCHEN_CHECK(scheduler.nextDish()->getName() == first.getName());
+    KITCHEN_CHECK(scheduler.setDeadline(third, 100));
+    KITCHEN_CHECK(scheduler.nextDish()->getName() == third.getName());
+    KITCHEN_CHECK(!scheduler.bump(third, 100));
+    KITCHEN_CHECK(scheduler.bump(second, 99));
+    KITCHEN_CHECK(scheduler.nextDish()->getName() == second.getName());
+    KITCHEN_CHECK(scheduler.serveNext());
+    KITCHEN_CHECK(scheduler.serveNext());
+    KITCHEN_CHECK(scheduler.nextDish()->getName() == first.getName());
+}
+
+} // namespace
+
+int main() {
+    for (unsigned seed = 1; seed <= 4; ++seed) {
+        testRandomOperations(seed, KitchenScheduler::SHORTEST_PREP_FIRST);
+        testRandomOperations(seed, KitchenScheduler::EARLIEST_DEADLINE_FIRST);
+    }
+    testDishNotInKitchen();
+    return 0;
+}
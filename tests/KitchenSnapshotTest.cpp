@@ -0,0 +1,226 @@
+/**
+ * @file KitchenSnapshotTest.cpp
+ * @brief This file contains the tests of the Kitchen binary snapshot: a round trip, the rejection of files whose
+ * header totals disagree with their records, the totals of a restored kitchen as it changes, and the rejection of
+ * snapshots whose dishes could not all be in one kitchen.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenInvariants.hpp"
+#include "KitchenSnapshot.hpp"
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @param bytes A snapshot as written to a stream.
+ * @param size Set to the size of the snapshot in bytes.
+ * @return The snapshot in 8-byte aligned storage, as KitchenSnapshotView::openBuffer requires.
+ */
+std::vector<std::uint64_t> toBuffer(const std::string& bytes, std::size_t& size) {
+    std::vector<std::uint64_t> buffer((bytes.size() + 7) / 8);
+    std::memcpy(buffer.data(), bytes.data(), bytes.size());
+    size = bytes.size();
+    return buffer;
+}
+
+/**
+ * @param kitchen The kitchen to save.
+ * @param size Set to the size of the snapshot in bytes.
+ * @return The snapshot of the kitchen, see `toBuffer`.
+ */
+std::vector<std::uint64_t> saveToBuffer(const Kitchen& kitchen, std::size_t& size) {
+    std::ostringstream out;
+    KITCHEN_CHECK(kitchen.saveSnapshot(out));
+    return toBuffer(out.str(), size);
+}
+
+/**
+ * @param dishes The dishes to write, none of them elaborate, with totals matching them.
+ * @param size Set to the size of the snapshot in bytes.
+ * @return The snapshot, see `toBuffer`.
+ */
+std::vector<std::uint64_t> writeToBuffer(const std::vector<Dish>& dishes, std::size_t& size) {
+    KitchenSnapshotWriter writer;
+    long long prep_time_sum = 0;
+    Price revenue;
+    std::array<int, Dish::CUISINE_TYPE_COUNT> cuisine_counts{};
+    for (const Dish& a_dish : dishes) {
+        writer.addDish(a_dish, false);
+        prep_time_sum += a_dish.getPrepTime();
+        revenue += a_dish.getPriceValue();
+        cuisine_counts[a_dish.getCuisineTypeEnum()]++;
+    }
+    writer.setTotals(prep_time_sum, revenue, 0, cuisine_counts);
+    std::ostringstream out;
+    KITCHEN_CHECK(writer.writeTo(out));
+    return toBuffer(out.str(), size);
+}
+
+/**
+ * @param buffer A snapshot in aligned storage.
+ * @return Its header, to be edited in place.
+ */
+KitchenSnapshotHeader& headerOf(std::vector<std::uint64_t>& buffer) {
+    return *reinterpret_cast<KitchenSnapshotHeader*>(buffer.data());
+}
+
+void testRoundTrip() {
+    std::mt19937 random(21);
+    Kitchen original;
+    for (int i = 0; i < 3000; ++i) {
+        original.newOrder(testDish(random, i));
+    }
+    checkKitchenInvariants(original);
+
+    std::size_t size = 0;
+    std::vector<std::uint64_t> buffer = saveToBuffer(original, size);
+    KitchenSnapshotView view;
+    KITCHEN_CHECK(view.openBuffer(buffer.data(), size));
+    KITCHEN_CHECK(view.dishCount() == original.getCurrentSize());
+
+    Kitchen restored;
+    restored.newOrder(testDish(random, 5000)); // replaced by the restore
+    KITCHEN_CHECK(restored.restoreSnapshot(view));
+    checkKitchenInvariants(restored);
+    KITCHEN_CHECK(restored.getCurrentSize() == original.getCurrentSize());
+    for (int slot = 0; slot < original.getCurrentSize(); ++slot) {
+        KITCHEN_CHECK(restored.getDishAt(slot) == original.getDishAt(slot));
+    }
+    KITCHEN_CHECK(restored.stats() == original.stats());
+}
+
+void testEditedTotalsRejected() {
+    std::mt19937 random(7);
+    Kitchen kitchen;
+    for (int i = 0; i < 200; ++i) {
+        kitchen.newOrder(testDish(random, i));
+    }
+    std::size_t size = 0;
+    const std::vector<std::uint64_t> saved = saveToBuffer(kitchen, size);
+
+    std::vector<std::uint64_t> buffer = saved;
+    headerOf(buffer).total_prep_time += 1;
+    KitchenSnapshotView view;
+    KITCHEN_CHECK(!view.openBuffer(buffer.data(), size));
+
+    buffer = saved;
+    headerOf(buffer).total_prep_time = std::int64_t(1) << 40; // would have been narrowed by a cast to int
+    KITCHEN_CHECK(!view.openBuffer(buffer.data(), size));
+
+    buffer = saved;
+    headerOf(buffer).total_revenue_cents -= 1;
+    KITCHEN_CHECK(!view.openBuffer(buffer.data(), size));
+
+    buffer = saved;
+    headerOf(buffer).elaborate_count += 1;
+    KITCHEN_CHECK(!view.openBuffer(buffer.data(), size));
+
+    // Moving one dish between cuisines keeps the sum of the cuisine counts, but not the counts
+    buffer = saved;
+    headerOf(buffer).cuisine_counts[0] += 1;
+    headerOf(buffer).cuisine_counts[1] -= 1;
+    KITCHEN_CHECK(!view.openBuffer(buffer.data(), size));
+
+    buffer = saved;
+    KITCHEN_CHECK(view.openBuffer(buffer.data(), size));
+}
+
+void testRestoredKitchenChanges() {
+    std::mt19937 random(3);
+    std::vector<Dish> dishes;
+    Kitchen kitchen;
+    for (int i = 0; i < 500; ++i) {
+        dishes.push_back(testDish(random, i));
+        kitchen.newOrder(dishes.back());
+    }
+    std::size_t size = 0;
+    std::vector<std::uint64_t> buffer = saveToBuffer(kitchen, size);
+    KitchenSnapshotView view;
+    KITCHEN_CHECK(view.openBuffer(buffer.data(), size));
+    Kitchen restored;
+    KITCHEN_CHECK(restored.restoreSnapshot(view));
+
+    for (std::size_t i = 0; i < dishes.size(); i += 2) {
+        KITCHEN_CHECK(restored.serveDish(dishes[i]));
+    }
+    checkKitchenInvariants(restored);
+    restored.releaseDishesBelowPrepTime(40);
+    checkKitchenInvariants(restored);
+    for (std::size_t i = 1; i < dishes.size(); i += 2) {
+        restored.serveDish(dishes[i]);
+    }
+    checkKitchenInvariants(restored);
+    KITCHEN_CHECK(restored.isEmpty());
+    KITCHEN_CHECK(restored.getPrepTimeSum() == 0);
+    KITCHEN_CHECK(restored.totalRevenue() == Price());
+    KITCHEN_CHECK(restored.elaborateDishCount() == 0);
+}
+
+void testInvalidDishesRejected() {
+    Kitchen kitchen;
+    KITCHEN_CHECK(kitchen.newOrder(Dish("Tacos", { "Beef" }, 20, 5.0, Dish::MEXICAN)));
+    KITCHEN_CHECK(kitchen.newOrder(Dish("Soup", { "Beef" }, 20, 5.0, Dish::MEXICAN)));
+    std::size_t size = 0;
+    std::vector<std::uint64_t> buffer = saveToBuffer(kitchen, size);
+    KitchenSnapshotView view;
+    KITCHEN_CHECK(view.openBuffer(buffer.data(), size) && view.hasDistinctValidDishes());
+
+    Kitchen restored;
+    KITCHEN_CHECK(restored.newOrder(Dish("Rice", {}, 5, 1.0, Dish::OTHER)));
+    const std::vector<Dish> before = restored.toVector();
+
+    // Both names would become "UNKNOWN", making the two dishes equal; the totals still match
+    char* bytes = reinterpret_cast<char*>(buffer.data());
+    char* first_name = bytes + (view.name(0).data() - bytes);
+    char* second_name = bytes + (view.name(1).data() - bytes);
+    first_name[3] = '0';
+    KITCHEN_CHECK(view.openBuffer(buffer.data(), size));
+    KITCHEN_CHECK(view.name(0) == "Tac0s" && !view.hasDistinctValidDishes());
+    KITCHEN_CHECK(!restored.restoreSnapshot(view));
+    second_name[1] = '0';
+    KITCHEN_CHECK(view.openBuffer(buffer.data(), size));
+    KITCHEN_CHECK(view.dishAt(0) == view.dishAt(1));
+    KITCHEN_CHECK(!restored.restoreSnapshot(view));
+    KITCHEN_CHECK(restored.toVector() == before);
+    checkKitchenInvariants(restored);
+
+    // Equal dishes are rejected, dishes differing only in price are not
+    Dish tacos("Tacos", { "Beef" }, 20, 5.0, Dish::MEXICAN);
+    Dish cheaper_tacos("Tacos", { "Beef" }, 20, 4.5, Dish::MEXICAN);
+    buffer = writeToBuffer({ tacos, cheaper_tacos, tacos }, size);
+    KITCHEN_CHECK(view.openBuffer(buffer.data(), size) && !view.hasDistinctValidDishes());
+    KITCHEN_CHECK(!restored.restoreSnapshot(view));
+    KITCHEN_CHECK(restored.toVector() == before);
+    buffer = writeToBuffer({ tacos, cheaper_tacos }, size);
+    KITCHEN_CHECK(view.openBuffer(buffer.data(), size) && view.hasDistinctValidDishes());
+    KITCHEN_CHECK(restored.restoreSnapshot(view));
+    KITCHEN_CHECK(restored.getCurrentSize() == 2 && restored.totalRevenue() == Price::fromCents(950));
+    checkKitchenInvariants(restored);
+
+    // Preparation times adding up to more than the kitchen's int total are rejected
+    Dish stew("Stew", {}, INT_MAX, 1.0, Dish::OTHER);
+    Dish roast("Roast", {}, 1, 1.0, Dish::OTHER);
+    buffer = writeToBuffer({ stew, roast }, size);
+    KITCHEN_CHECK(view.openBuffer(buffer.data(), size));
+    KITCHEN_CHECK(!restored.restoreSnapshot(view));
+    KITCHEN_CHECK(restored.getCurrentSize() == 2);
+}
+
+} // namespace
+
+int main() {
+    testRoundTrip();
+    testEditedTotalsRejected();
+    testRestoredKitchenChanges();
+    testInvalidDishesRejected();
+    return 0;
+}
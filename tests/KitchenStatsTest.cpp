@@ -0,0 +1,139 @@
+/**
+ * @file KitchenStatsTest.cpp
+ * @brief This file contains the tests of KitchenStats and of the report figures every kitchen computes through it.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "ConcurrentKitchen.hpp"
+#include "KitchenInvariants.hpp"
+#include "KitchenStats.hpp"
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+void testElaboratePercentage() {
+    KITCHEN_CHECK(KitchenStats::elaboratePercentage(0, 0) == 0.0);
+    KITCHEN_CHECK(KitchenStats::elaboratePercentage(0, 10) == 0.0);
+    KITCHEN_CHECK(KitchenStats::elaboratePercentage(7, 50) == 14.0);
+    KITCHEN_CHECK(KitchenStats::elaboratePercentage(1, 3) == 33.34);
+    KITCHEN_CHECK(KitchenStats::elaboratePercentage(2, 3) == 66.67);
+    KITCHEN_CHECK(KitchenStats::elaboratePercentage(1, 1000000) == 0.01);
+    KITCHEN_CHECK(KitchenStats::elaboratePercentage(5, 5) == 100.0);
+    // Every exact percentage of every count below 1000 stays exact
+    for (long long dish_count = 1; dish_count < 1000; ++dish_count) {
+        for (long long elaborate_count = 0; elaborate_count <= dish_count; ++elaborate_count) {
+            if (10000 * elaborate_count % dish_count == 0) {
+                long long hundredths = 10000 * elaborate_count / dish_count;
+                KITCHEN_CHECK(KitchenStats::elaboratePercentage(elaborate_count, dish_count) == hundredths / 100.0);
+            }
+        }
+    }
+}
+
+void testAveragePrepTime() {
+    KITCHEN_CHECK(KitchenStats::averagePrepTime(0, 0) == 0);
+    KITCHEN_CHECK(KitchenStats::averagePrepTime(10, 4) == 3);
+    KITCHEN_CHECK(KitchenStats::averagePrepTime(9, 4) == 2);
+    KITCHEN_CHECK(KitchenStats::averagePrepTime(60, 3) == 20);
+}
+
+void testCallersAgree() {
+    // 7 elaborate dishes of 50: the case a floating-point ceil reported as 14.01%
+    Kitchen kitchen;
+    ConcurrentKitchen concurrent_kitchen(4);
+    for (int i = 0; i < 50; ++i) {
+        std::vector<std::string> ingredients;
+        int prep_time = 10;
+        if (i < 7) {
+            ingredients = { "Salt", "Pepper", "Garlic", "Onion", "Rice" };
+            prep_time = 90;
+        }
+        Dish a_dish(testDishName(i), ingredients, prep_time, 10.0, Dish::ITALIAN);
+        KITCHEN_CHECK(kitchen.newOrder(a_dish));
+        KITCHEN_CHECK(concurrent_kitchen.newOrder(a_dish));
+    }
+    KITCHEN_CHECK(kitchen.elaborateDishCount() == 7);
+    KITCHEN_CHECK(kitchen.calculateElaboratePercentage() == 14.0);
+    KITCHEN_CHECK(kitchen.stats().calculateElaboratePercentage() == 14.0);
+    KITCHEN_CHECK(concurrent_kitchen.calculateElaboratePercentage() == 14.0);
+    KITCHEN_CHECK(kitchen.calculateAvgPrepTime() == concurrent_kitchen.calculateAvgPrepTime());
+    KITCHEN_CHECK(kitchen.calculateAvgPrepTime() == kitchen.stats().calculateAvgPrepTime());
+    checkKitchenInvariants(kitchen);
+}
+
+// Offsets of the counts in the record written by KitchenStats::serialize
+const std::size_t DISH_COUNT_OFFSET = 24;
+const std::size_t ELABORATE_COUNT_OFFSET = 48;
+const std::size_t CUISINE_COUNTS_OFFSET = 56;
+const std::size_t BUCKETS_OFFSET = CUISINE_COUNTS_OFFSET + 8 * Dish::CUISINE_TYPE_COUNT;
+
+std::string withCount(std::string data, std::size_t offset, std::int64_t count) {
+    std::memcpy(&data[offset], &count, sizeof(count));
+    return data;
+}
+
+std::int64_t countAt(const std::string& data, std::size_t offset) {
+    std::int64_t count;
+    std::memcpy(&count, &data[offset], sizeof(count));
+    return count;
+}
+
+void testDeserialize() {
+    std::mt19937 random(28);
+    Kitchen kitchen;
+    for (int i = 0; i < 200; ++i) {
+        kitchen.newOrder(testDish(random, i));
+    }
+    std::string report;
+    kitchen.appendReport(report);
+    std::string stats_report;
+    kitchen.stats().appendReport(stats_report);
+    KITCHEN_CHECK(report == stats_report);
+
+    std::string data;
+    kitchen.stats().serialize(data);
+    KitchenStats restored;
+    KITCHEN_CHECK(KitchenStats::deserialize(data, restored));
+    KITCHEN_CHECK(restored == kitchen.stats());
+    KITCHEN_CHECK(countAt(data, DISH_COUNT_OFFSET) == 200);
+    std::int64_t cuisine_total = 0;
+    for (int c = 0; c < Dish::CUISINE_TYPE_COUNT; ++c) {
+        cuisine_total += countAt(data, CUISINE_COUNTS_OFFSET + 8 * c);
+    }
+    KITCHEN_CHECK(cuisine_total == 200);
+
+    KitchenStats untouched;
+    KITCHEN_CHECK(!KitchenStats::deserialize(withCount(data, DISH_COUNT_OFFSET, 201), untouched));
+    KITCHEN_CHECK(!KitchenStats::deserialize(withCount(data, DISH_COUNT_OFFSET, -1), untouched));
+    KITCHEN_CHECK(!KitchenStats::deserialize(withCount(data, ELABORATE_COUNT_OFFSET, 201), untouched));
+    KITCHEN_CHECK(!KitchenStats::deserialize(withCount(data, ELABORATE_COUNT_OFFSET, -1), untouched));
+    std::int64_t first_cuisine = countAt(data, CUISINE_COUNTS_OFFSET);
+    KITCHEN_CHECK(!KitchenStats::deserialize(withCount(data, CUISINE_COUNTS_OFFSET, first_cuisine + 1), untouched));
+    std::string shifted = withCount(data, CUISINE_COUNTS_OFFSET, first_cuisine - 201);
+    shifted = withCount(shifted, CUISINE_COUNTS_OFFSET + 8, countAt(data, CUISINE_COUNTS_OFFSET + 8) + 201);
+    KITCHEN_CHECK(!KitchenStats::deserialize(shifted, untouched));
+    KITCHEN_CHECK(!KitchenStats::deserialize(withCount(data, BUCKETS_OFFSET, countAt(data, BUCKETS_OFFSET) + 1),
+                                             untouched));
+    KITCHEN_CHECK(untouched == KitchenStats());
+
+    // Counts that only exchange dishes between cuisine types are still consistent
+    std::string moved = withCount(data, CUISINE_COUNTS_OFFSET, first_cuisine + 1);
+    moved = withCount(moved, CUISINE_COUNTS_OFFSET + 8, countAt(data, CUISINE_COUNTS_OFFSET + 8) - 1);
+    KITCHEN_CHECK(countAt(data, CUISINE_COUNTS_OFFSET + 8) == 0 || KitchenStats::deserialize(moved, untouched));
+}
+
+} // namespace
+
+int main() {
+    testElaboratePercentage();
+    testAveragePrepTime();
+    testCallersAgree();
+    testDeserialize();
+    return 0;
+}
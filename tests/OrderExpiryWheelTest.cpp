@@ -0,0 +1,171 @@
+/**
+ * @file OrderExpiryWheelTest.cpp
+ * @brief This file contains a randomized test of OrderExpiryWheel against a plain list of order times: every slot
+ * expires at the first `advance` past its expiry time, in expiry order, through short steps, long jumps across the
+ * levels, TTL changes, moved slots and compaction.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "OrderExpiryWheel.hpp"
+#include "TestSupport.hpp"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+typedef OrderExpiryWheel::Time Time;
+
+/**
+ * A wheel and the order times it should hold, slot for slot. Removing a slot moves the last slot into it, as a
+ * Kitchen does.
+ */
+struct Checked {
+    OrderExpiryWheel wheel;
+    std::vector<Time> order_times;
+
+    void removeSlot(int slot) {
+        int last_slot = wheel.size() - 1;
+        wheel.erase(slot);
+        if (slot != last_slot) {
+            wheel.moveSlot(last_slot, slot);
+            order_times[slot] = order_times[last_slot];
+        }
+        wheel.truncate(last_slot);
+        order_times.pop_back();
+    }
+
+    void check() const {
+        KITCHEN_CHECK(wheel.size() == static_cast<int>(order_times.size()));
+        for (int slot = 0; slot < wheel.size(); ++slot) {
+            KITCHEN_CHECK(wheel.orderTime(slot) == order_times[slot]);
+        }
+    }
+
+    void advance(Time now) {
+        Time ttl = wheel.ttl();
+        Time before = wheel.currentTime();
+        int expected = 0;
+        for (Time order_time : order_times) {
+            expected += ttl > 0 && now >= before && order_time + ttl <= now;
+        }
+        Time last_expiry = 0;
+        bool first = true;
+        int expired = wheel.advance(now, [&](int slot) {
+            Time expiry = order_times[slot] + ttl;
+            KITCHEN_CHECK(expiry <= now);
+            // Slots made overdue by a shorter TTL go first; the others in expiry order
+            if (expiry >= before) {
+                KITCHEN_CHECK(first || expiry >= last_expiry);
+                last_expiry = expiry;
+                first = false;
+            }
+            removeSlot(slot);
+        });
+        KITCHEN_CHECK(expired == expected);
+        KITCHEN_CHECK(wheel.currentTime() == (now >= before ? now : before));
+        for (Time order_time : order_times) {
+            KITCHEN_CHECK(ttl <= 0 || order_time + ttl > wheel.currentTime());
+        }
+        check();
+    }
+};
+
+void testRandomOperations(unsigned seed) {
+    std::mt19937 random(seed);
+    Checked checked;
+    checked.wheel.setTtl(50);
+    for (int step = 0; step < 4000; ++step) {
+        switch (random() % 10) {
+            case 0: case 1: case 2: case 3: {
+                // Orders are stamped with the clock, as in a Kitchen, or with any time not far behind it
+                Time order_time = checked.wheel.currentTime() - static_cast<Time>(random() % 3);
+                checked.wheel.pushBack(order_time);
+                checked.order_times.push_back(order_time);
+                break;
+            }
+            case 4: {
+                if (checked.wheel.size() > 0) {
+                    checked.removeSlot(static_cast<int>(random() % checked.wheel.size()));
+                }
+                break;
+            }
+            case 5: {
+                std::vector<std::uint8_t> mask(checked.wheel.size());
+                std::vector<Time> kept;
+                for (int slot = 0; slot < checked.wheel.size(); ++slot) {
+                    mask[slot] = random() % 4 == 0;
+                    if (!mask[slot]) {
+                        kept.push_back(checked.order_times[slot]);
+                    }
+                }
+                checked.wheel.compactMarked(mask.data());
+                checked.order_times = kept;
+                break;
+            }
+            case 6: {
+                // Long TTLs place slots on the upper levels and in the overflow list
+                const Time TTLS[] = { 0, 1, 30, 200, 5000, 400000, Time(1) << 31, Time(1) << 40 };
+                checked.wheel.setTtl(TTLS[random() % 8]);
+                break;
+            }
+            case 7: {
+                Time jump = static_cast<Time>(random() % 3 == 0 ? random() % (Time(1) << 24) : random() % 5000);
+                checked.advance(checked.wheel.currentTime() + jump);
+                break;
+            }
+            default: {
+                checked.advance(checked.wheel.currentTime() + static_cast<Time>(random() % 70));
+                break;
+            }
+        }
+        checked.check();
+    }
+    checked.wheel.clear();
+    checked.order_times.clear();
+    checked.advance(checked.wheel.currentTime() + 1000);
+}
+
+void testLongHorizon() {
+    // Expiry times beyond every level wait in the overflow list until the clock reaches their run
+    Checked checked;
+    checked.wheel.setTtl(Time(1) << 31);
+    for (int i = 0; i < 100; ++i) {
+        checked.wheel.pushBack(i);
+        checked.order_times.push_back(i);
+    }
+    checked.advance((Time(1) << 31) - 1);
+    KITCHEN_CHECK(checked.wheel.size() == 100);
+    checked.advance((Time(1) << 31) + 49);
+    KITCHEN_CHECK(checked.wheel.size() == 50);
+    checked.advance(Time(1) << 32);
+    KITCHEN_CHECK(checked.wheel.size() == 0);
+}
+
+void testEarlierTimesIgnored() {
+    Checked checked;
+    checked.wheel.setTtl(10);
+    checked.advance(100);
+    checked.wheel.pushBack(100);
+    checked.order_times.push_back(100);
+    checked.advance(50);
+    KITCHEN_CHECK(checked.wheel.currentTime() == 100);
+    checked.wheel.setTtl(1);
+    checked.advance(100);
+    KITCHEN_CHECK(checked.wheel.size() == 1);
+    checked.advance(101);
+    KITCHEN_CHECK(checked.wheel.size() == 0);
+}
+
+} // namespace
+
+int main() {
+    for (unsigned seed = 1; seed <= 6; ++seed) {
+        testRandomOperations(seed);
+    }
+    testLongHorizon();
+    testEarlierTimesIgnored();
+    return 0;
+}
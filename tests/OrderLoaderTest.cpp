@@ -0,0 +1,91 @@
+/**
+ * @file OrderLoaderTest.cpp
+ * @brief This file contains the tests of OrderLoader: row parsing, numbers with exponents, and rows with invalid
+ * names counted as malformed.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenInvariants.hpp"
+#include "OrderLoader.hpp"
+#include <sstream>
+#include <string>
+
+namespace {
+
+void testNames() {
+    KITCHEN_CHECK(Dish::isValidName("Pad Thai"));
+    KITCHEN_CHECK(!Dish::isValidName("Dish 42"));
+    KITCHEN_CHECK(!Dish::isValidName("Cr\xC3\xA8me Br\xC3\xBBl\xC3\xA9" "e"));
+    KITCHEN_CHECK(!Dish::isValidName("\xFF\x80"));
+
+    Dish a_dish;
+    KITCHEN_CHECK(OrderLoader::parseCsvRow("Pad Thai,Noodles;Peanuts,25,12.50,OTHER", a_dish));
+    KITCHEN_CHECK(a_dish.getName() == "Pad Thai");
+    KITCHEN_CHECK(!OrderLoader::parseCsvRow("Cr\xC3\xA8me Br\xC3\xBBl\xC3\xA9" "e,Cream,30,8.00,FRENCH", a_dish));
+    KITCHEN_CHECK(!OrderLoader::parseCsvRow("Dish 42,Salt,5,1.00,OTHER", a_dish));
+    KITCHEN_CHECK(!OrderLoader::parseJsonRow("{\"name\": \"Caf\xC3\xA9\", \"prep_time\": 5}", a_dish));
+    KITCHEN_CHECK(OrderLoader::parseJsonRow("{\"prep_time\": 5}", a_dish));
+    KITCHEN_CHECK(a_dish.getName() == "UNKNOWN");
+}
+
+void testInvalidNamesAreMalformed() {
+    std::istringstream in(
+        "name,ingredients,prep_time,price,cuisine_type\n"
+        "Pad Thai,Noodles;Peanuts,25,12.50,OTHER\n"
+        "Cr\xC3\xA8me Br\xC3\xBBl\xC3\xA9" "e,Cream,30,8.00,FRENCH\n"
+        "Cr\xC3\xA8me Caramel,Cream,35,7.00,FRENCH\n"
+        "Dish 42,Salt,5,1.00,OTHER\n"
+        "Pad Thai,Noodles;Peanuts,25,12.50,OTHER\n");
+    Kitchen kitchen;
+    OrderLoader::Stats stats = OrderLoader().load(in, kitchen);
+    KITCHEN_CHECK(stats.rows == 5);
+    KITCHEN_CHECK(stats.malformed == 3);
+    KITCHEN_CHECK(stats.added == 1);
+    KITCHEN_CHECK(stats.refused == 1); // only the real duplicate
+    checkKitchenInvariants(kitchen);
+}
+
+void testNumbers() {
+    Dish a_dish;
+    KITCHEN_CHECK(OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"prep_time\": 2.5e1, \"price\": 1.25e1}", a_dish));
+    KITCHEN_CHECK(a_dish.getPrepTime() == 25);
+    KITCHEN_CHECK(a_dish.getPriceValue() == Price::fromCents(1250));
+    KITCHEN_CHECK(OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"prep_time\": 30.0, \"price\": 125E-2}", a_dish));
+    KITCHEN_CHECK(a_dish.getPrepTime() == 30);
+    KITCHEN_CHECK(a_dish.getPriceValue() == Price::fromCents(125));
+    KITCHEN_CHECK(OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"price\": 1.2e+1}", a_dish));
+    KITCHEN_CHECK(a_dish.getPriceValue() == Price::fromCents(1200));
+    KITCHEN_CHECK(OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"price\": 0.125}", a_dish));
+    KITCHEN_CHECK(a_dish.getPriceValue() == Price::fromCents(13));
+    KITCHEN_CHECK(OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"price\": -0.125}", a_dish));
+    KITCHEN_CHECK(a_dish.getPriceValue() == Price::fromCents(-13));
+    KITCHEN_CHECK(OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"price\": 0.1249}", a_dish));
+    KITCHEN_CHECK(a_dish.getPriceValue() == Price::fromCents(12));
+    KITCHEN_CHECK(OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"price\": 1e-30}", a_dish));
+    KITCHEN_CHECK(a_dish.getPriceValue() == Price::fromCents(0));
+    KITCHEN_CHECK(OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"price\": 0.000000000000000000000000012345e26}",
+                                            a_dish));
+    KITCHEN_CHECK(a_dish.getPriceValue() == Price::fromCents(123));
+    KITCHEN_CHECK(OrderLoader::parseCsvRow("Soup,Water,10,4.5e0,OTHER", a_dish));
+    KITCHEN_CHECK(a_dish.getPriceValue() == Price::fromCents(450));
+
+    KITCHEN_CHECK(!OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"prep_time\": 2.55e1}", a_dish));
+    KITCHEN_CHECK(!OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"prep_time\": 3e9}", a_dish));
+    KITCHEN_CHECK(!OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"price\": 1e400}", a_dish));
+    KITCHEN_CHECK(!OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"price\": 1e}", a_dish));
+    KITCHEN_CHECK(!OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"price\": e5}", a_dish));
+    KITCHEN_CHECK(!OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"price\": 1.2.3}", a_dish));
+    KITCHEN_CHECK(!OrderLoader::parseJsonRow("{\"name\": \"Soup\", \"price\": .}", a_dish));
+    KITCHEN_CHECK(!OrderLoader::parseCsvRow("Soup,Water,10,99999999999999999999,OTHER", a_dish));
+}
+
+} // namespace
+
+int main() {
+    testNames();
+    testInvalidNamesAreMalformed();
+    testNumbers();
+    return 0;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file OrderTicketQueueTest.cpp
+ * @brief This file contains the tests of OrderTicketQueue: backpressure and metrics on a full queue, and several
+ * producers feeding one draining consumer without losing or duplicating a ticket.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "OrderTicketQueue.hpp"
+#include "TestSupport.hpp"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+Dish ticket(int index) {
+    return Dish(testDishName(index), {"Salt"}, index % 90, 10.0, Dish::CuisineType::OTHER);
+}
+
+void testBackpressure() {
+    OrderTicketQueue queue(5);
+    KITCHEN_CHECK(queue.getCapacity() == 8);
+    for (int i = 0; i < 8; ++i) {
+        Dish a_dish = ticket(i);
+        KITCHEN_CHECK(queue.tryPush(std::move(a_dish)));
+        KITCHEN_CHECK(queue.depth() == i + 1);
+    }
+
+    // A full queue turns the push away and leaves the dish with the caller
+    Dish refused = ticket(8);
+    KITCHEN_CHECK(!queue.tryPush(std::move(refused)));
+    KITCHEN_CHECK(refused.getName() == testDishName(8));
+    OrderTicketQueue::Metrics metrics = queue.getMetrics();
+    KITCHEN_CHECK(metrics.enqueued == 8);
+    KITCHEN_CHECK(metrics.rejected_full == 1);
+    KITCHEN_CHECK(metrics.dequeued == 0);
+    KITCHEN_CHECK(metrics.depth == 8);
+    KITCHEN_CHECK(metrics.high_water_mark == 8);
+    KITCHEN_CHECK(metrics.capacity == 8);
+
+    Dish popped;
+    KITCHEN_CHECK(queue.tryPop(popped));
+    KITCHEN_CHECK(popped.getName() == testDishName(0));
+    KITCHEN_CHECK(queue.tryPush(std::move(refused)));
+    KITCHEN_CHECK(queue.depth() == 8);
+
+    // Tickets come out in push order; a ticket already in the kitchen is counted as refused
+    Kitchen kitchen(true);
+    KITCHEN_CHECK(kitchen.newOrder(ticket(3)));
+    KITCHEN_CHECK(queue.drainInto(kitchen, 3) == 2);
+    KITCHEN_CHECK(queue.depth() == 5);
+    for (int i = 4; i <= 8; ++i) {
+        KITCHEN_CHECK(queue.tryPop(popped));
+        KITCHEN_CHECK(popped.getName() == testDishName(i));
+    }
+    KITCHEN_CHECK(!queue.tryPop(popped));
+
+    metrics = queue.getMetrics();
+    KITCHEN_CHECK(metrics.enqueued == 9);
+    KITCHEN_CHECK(metrics.rejected_full == 1);
+    KITCHEN_CHECK(metrics.dequeued == 9);
+    KITCHEN_CHECK(metrics.orders_added == 2);
+    KITCHEN_CHECK(metrics.orders_refused == 1);
+    KITCHEN_CHECK(metrics.depth == 0);
+    KITCHEN_CHECK(metrics.high_water_mark == 8);
+}
+
+void testProducersAndConsumer() {
+    const int PRODUCERS = 4;
+    const int TICKETS_PER_PRODUCER = 5000;
+    const int TICKETS = PRODUCERS * TICKETS_PER_PRODUCER;
+    OrderTicketQueue queue(64);
+    Kitchen kitchen(true);
+    std::atomic<std::uint64_t> rejected{0};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&queue, &rejected, p]() {
+            for (int i = 0; i < TICKETS_PER_PRODUCER; ++i) {
+                Dish a_dish = ticket(p * TICKETS_PER_PRODUCER + i);
+                while (!queue.tryPush(std::move(a_dish))) {
+                    rejected++;
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    int added = 0;
+    while (queue.getMetrics().dequeued < static_cast<std::uint64_t>(TICKETS)) {
+        int depth = queue.depth();
+        KITCHEN_CHECK(depth >= 0 && depth <= queue.getCapacity());
+        added += queue.drainInto(kitchen, 16);
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+
+    // Every name is distinct, so a duplicated ticket would be refused and a lost one would be missing
+    KITCHEN_CHECK(added == TICKETS);
+    KITCHEN_CHECK(kitchen.getCurrentSize() == TICKETS);
+    for (int i = 0; i < TICKETS; ++i) {
+        KITCHEN_CHECK(kitchen.contains(ticket(i)));
+    }
+    OrderTicketQueue::Metrics metrics = queue.getMetrics();
+    KITCHEN_CHECK(metrics.enqueued == static_cast<std::uint64_t>(TICKETS));
+    KITCHEN_CHECK(metrics.dequeued == static_cast<std::uint64_t>(TICKETS));
+    KITCHEN_CHECK(metrics.orders_added == static_cast<std::uint64_t>(TICKETS));
+    KITCHEN_CHECK(metrics.orders_refused == 0);
+    KITCHEN_CHECK(metrics.rejected_full == rejected.load());
+    KITCHEN_CHECK(metrics.depth == 0);
+    KITCHEN_CHECK(metrics.high_water_mark >= 1 && metrics.high_water_mark <= metrics.capacity);
+}
+
+} // namespace
+
+int main() {
+    testBackpressure();
+    testProducersAndConsumer();
+    return 0;
+}
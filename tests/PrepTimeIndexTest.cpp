@@ -0,0 +1,110 @@
+/**
+ * @file PrepTimeIndexTest.cpp
+ * @brief This file contains the tests of PrepTimeIndex: its queries against a sorted reference while updates are
+ * buffered and merged, and const queries from several threads at once.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "KitchenInvariants.hpp"
+#include "PrepTimeIndex.hpp"
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @param index The index to check.
+ * @param reference The same preparation times, sorted.
+ */
+void checkAgainst(const PrepTimeIndex& index, const std::vector<int>& reference) {
+    KITCHEN_CHECK(index.size() == static_cast<int>(reference.size()));
+    for (int threshold : { -1, 0, 1, 17, 60, 119, 120, 1000 }) {
+        int below = static_cast<int>(std::lower_bound(reference.begin(), reference.end(), threshold) - reference.begin());
+        KITCHEN_CHECK(index.countBelow(threshold) == below);
+        int in_range = static_cast<int>(std::upper_bound(reference.begin(), reference.end(), threshold + 10)
+                                        - std::lower_bound(reference.begin(), reference.end(), threshold));
+        KITCHEN_CHECK(index.countInRange(threshold, threshold + 10) == in_range);
+    }
+    KITCHEN_CHECK(index.countInRange(10, 5) == 0);
+    KITCHEN_CHECK(index.percentile(0) == (reference.empty() ? 0 : reference.front()));
+    KITCHEN_CHECK(index.percentile(100) == (reference.empty() ? 0 : reference.back()));
+}
+
+void testUpdates() {
+    std::mt19937 random(15);
+    PrepTimeIndex index;
+    std::vector<int> reference;
+    checkAgainst(index, reference);
+    for (int step = 0; step < 20000; ++step) {
+        if (reference.empty() || random() % 3 != 0) {
+            int prep_time = static_cast<int>(random() % 120);
+            index.insert(prep_time);
+            reference.insert(std::upper_bound(reference.begin(), reference.end(), prep_time), prep_time);
+        } else {
+            std::vector<int>::iterator victim = reference.begin() + random() % reference.size();
+            index.erase(*victim);
+            reference.erase(victim);
+        }
+        if (step % 997 == 0) {
+            checkAgainst(index, reference);
+        }
+    }
+    checkAgainst(index, reference);
+
+    PrepTimeIndex copy(index);
+    PrepTimeIndex moved(std::move(copy));
+    checkAgainst(moved, reference);
+    index.clear();
+    checkAgainst(index, std::vector<int>());
+    index = moved;
+    checkAgainst(index, reference);
+}
+
+void testConcurrentQueries() {
+    // Leave updates pending, so the first queries of every thread race to merge them
+    std::mt19937 random(25);
+    for (int round = 0; round < 50; ++round) {
+        PrepTimeIndex index;
+        for (int i = 0; i < 5000; ++i) {
+            index.insert(static_cast<int>(random() % 120));
+        }
+        KITCHEN_CHECK(index.countBelow(0) == 0); // merges the inserts
+        for (int i = 0; i < 40; ++i) {
+            index.insert(static_cast<int>(random() % 120));
+            index.erase(static_cast<int>(i % 5));
+        }
+        PrepTimeIndex expected(index);
+        const int below = expected.countBelow(60);
+        const int median = expected.percentile(50);
+
+        std::vector<std::thread> readers;
+        std::vector<int> failures(4, 0);
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&index, &failures, t, below, median]() {
+                for (int i = 0; i < 200; ++i) {
+                    if (index.countBelow(60) != below || index.percentile(50) != median) {
+                        failures[t]++;
+                    }
+                }
+            });
+        }
+        for (std::thread& reader : readers) {
+            reader.join();
+        }
+        for (int t = 0; t < 4; ++t) {
+            KITCHEN_CHECK(failures[t] == 0);
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    testUpdates();
+    testConcurrentQueries();
+    return 0;
+}
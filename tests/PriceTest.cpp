@@ -0,0 +1,58 @@
+/**
+ * @file PriceTest.cpp
+ * @brief This file contains the tests of Price's conversions from double, including the amounts it rejects.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "Dish.hpp"
+#include "Price.hpp"
+#include "TestSupport.hpp"
+#include <limits>
+
+namespace {
+
+void testRounding() {
+    KITCHEN_CHECK(Price::fromDouble(12.5).cents() == 1250);
+    KITCHEN_CHECK(Price::fromDouble(0.125).cents() == 13);
+    KITCHEN_CHECK(Price::fromDouble(-0.125).cents() == -13);
+    KITCHEN_CHECK(Price::fromDouble(0.0).cents() == 0);
+    Price price;
+    KITCHEN_CHECK(Price::fromDouble(9.99, price));
+    KITCHEN_CHECK(price == Price::fromCents(999));
+    KITCHEN_CHECK(Price::fromDouble(-9.0e16, price));
+    KITCHEN_CHECK(price.cents() == -9000000000000000000LL);
+}
+
+void testRejected() {
+    const double REJECTED[] = {
+        std::numeric_limits<double>::quiet_NaN(),
+        std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity(),
+        std::numeric_limits<double>::max(),
+        -std::numeric_limits<double>::max(),
+        9.3e16,
+        -9.3e16,
+    };
+    for (double amount : REJECTED) {
+        Price price = Price::fromCents(42);
+        KITCHEN_CHECK(!Price::fromDouble(amount, price));
+        KITCHEN_CHECK(price == Price::fromCents(42));
+        KITCHEN_CHECK(Price::fromDouble(amount) == Price());
+
+        Dish a_dish("Soup", {"Water"}, 10, amount);
+        KITCHEN_CHECK(a_dish.getPriceValue() == Price());
+        a_dish.setPrice(4.5);
+        a_dish.setPrice(amount);
+        KITCHEN_CHECK(a_dish.getPriceValue() == Price());
+    }
+}
+
+} // namespace
+
+int main() {
+    testRounding();
+    testRejected();
+    return 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file StringPoolTest.cpp
+ * @brief This file contains the tests of StringPool: interned strings round-trip through their Ids and stay in place
+ * as the pool grows, threads interning the same strings at once agree on their Ids, and a full pool throws without
+ * changing.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "StringPool.hpp"
+#include "TestSupport.hpp"
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+typedef StringPool::Id Id;
+
+void testRoundTrip() {
+    StringPool pool;
+    KITCHEN_CHECK(pool.size() == 0);
+    Id id;
+    KITCHEN_CHECK(!pool.find("Salt", id));
+
+    Id salt = pool.intern("Salt");
+    Id empty = pool.intern("");
+    Id with_nul = pool.intern(std::string_view("Salt\0Pepper", 11));
+    Id long_name = pool.intern(std::string(300, 'x'));
+    KITCHEN_CHECK(pool.size() == 4);
+    KITCHEN_CHECK(salt != empty && salt != with_nul && with_nul != long_name);
+    KITCHEN_CHECK(pool.intern(std::string("Salt")) == salt);
+    KITCHEN_CHECK(pool.size() == 4);
+    KITCHEN_CHECK(pool.lookup(salt) == "Salt");
+    KITCHEN_CHECK(pool.lookup(empty).empty());
+    KITCHEN_CHECK(pool.lookup(with_nul) == std::string("Salt\0Pepper", 11));
+    KITCHEN_CHECK(pool.lookup(long_name) == std::string(300, 'x'));
+    KITCHEN_CHECK(pool.find("Salt", id) && id == salt);
+    KITCHEN_CHECK(!pool.find("salt", id));
+
+    // Growing across many chunks moves no string, so earlier references stay valid
+    const std::string& salt_text = pool.lookup(salt);
+    const std::string* salt_address = &salt_text;
+    std::vector<Id> ids;
+    for (int i = 0; i < 20000; ++i) {
+        ids.push_back(pool.intern(testDishName(i)));
+    }
+    KITCHEN_CHECK(pool.size() == 20004);
+    KITCHEN_CHECK(&pool.lookup(salt) == salt_address && salt_text == "Salt");
+    for (int i = 0; i < 20000; ++i) {
+        KITCHEN_CHECK(pool.lookup(ids[i]) == testDishName(i));
+        KITCHEN_CHECK(pool.intern(testDishName(i)) == ids[i]);
+    }
+}
+
+void testConcurrentIntern() {
+    const int THREADS = 4;
+    const int STRINGS = 6000;
+    StringPool pool;
+    std::vector<std::vector<Id>> ids(THREADS, std::vector<Id>(STRINGS));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&pool, &ids, t]() {
+            // Every thread interns the same strings in its own order and reads them back while the pool grows
+            for (int i = 0; i < STRINGS; ++i) {
+                int index = (t % 2 == 0) ? i : STRINGS - 1 - i;
+                ids[t][index] = pool.intern(testDishName(index));
+                KITCHEN_CHECK(pool.lookup(ids[t][index]) == testDishName(index));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    KITCHEN_CHECK(pool.size() == STRINGS);
+    std::vector<bool> seen(STRINGS, false);
+    for (int i = 0; i < STRINGS; ++i) {
+        for (int t = 1; t < THREADS; ++t) {
+            KITCHEN_CHECK(ids[t][i] == ids[0][i]);
+        }
+        KITCHEN_CHECK(ids[0][i] < static_cast<Id>(STRINGS) && !seen[ids[0][i]]);
+        seen[ids[0][i]] = true;
+    }
+}
+
+void testSizeLimit() {
+    StringPool pool(10);
+    for (int i = 0; i < 10; ++i) {
+        KITCHEN_CHECK(pool.intern(testDishName(i)) == static_cast<Id>(i));
+    }
+    bool threw = false;
+    try {
+        pool.intern("One too many");
+    } catch (const std::length_error&) {
+        threw = true;
+    }
+    KITCHEN_CHECK(threw);
+
+    // A full pool still finds and re-interns what it holds
+    KITCHEN_CHECK(pool.size() == 10);
+    Id id;
+    KITCHEN_CHECK(!pool.find("One too many", id));
+    KITCHEN_CHECK(pool.intern(testDishName(3)) == 3);
+    KITCHEN_CHECK(pool.lookup(9) == testDishName(9));
+}
+
+} // namespace
+
+int main() {
+    testRoundTrip();
+    testConcurrentIntern();
+    testSizeLimit();
+    return 0;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file TestSupport.hpp
+ * @brief This file contains the check macro shared by the tests.
+ *
+ * Every test is a plain executable. KITCHEN_CHECK reports the failed condition with its file and line and exits with
+ * a nonzero status, so ctest marks the test failed. Unlike assert it is not compiled out in release builds.
+ * `testDishName` and `testDish` generate dishes whose names pass Dish's letters-and-spaces rule.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#ifndef KITCHEN_TEST_SUPPORT_HPP
+#define KITCHEN_TEST_SUPPORT_HPP
+
+#include "Dish.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#define KITCHEN_CHECK(condition)                                                                  \
+    do {                                                                                          \
+        if (!(condition)) {                                                                       \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);   \
+            std::exit(1);                                                                         \
+        }                                                                                         \
+    } while (false)
+
+/**
+ * @param index A number.
+ * @return A dish name made of letters only, distinct for every index.
+ */
+inline std::string testDishName(int index) {
+    std::string name = "Dish ";
+    do {
+        name += static_cast<char>('a' + index % 26);
+        index /= 26;
+    } while (index > 0);
+    return name;
+}
+
+/**
+ * @param random The generator the fields are drawn from.
+ * @param index A number, giving the dish's name.
+ * @return A dish with up to 6 ingredients from a small vocabulary, a preparation time below 120 minutes, a price
+ * below 100.00 and any cuisine type.
+ */
+inline Dish testDish(std::mt19937& random, int index) {
+    static const char* const INGREDIENTS[] = { "Salt", "Pepper", "Garlic", "Onion", "Rice", "Basil", "Lime", "Egg" };
+    std::vector<std::string> ingredients;
+    int ingredient_count = static_cast<int>(random() % 7);
+    for (int i = 0; i < ingredient_count; ++i) {
+        ingredients.push_back(INGREDIENTS[random() % 8]);
+    }
+    int prep_time = static_cast<int>(random() % 120);
+    double price = static_cast<int>(random() % 10000) / 100.0;
+    Dish::CuisineType cuisine_type = static_cast<Dish::CuisineType>(random() % Dish::CUISINE_TYPE_COUNT);
+    return Dish(testDishName(index), ingredients, prep_time, price, cuisine_type);
+}
+
+#endif
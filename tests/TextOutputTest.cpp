@@ -0,0 +1,166 @@
+/**
+ * @file TextOutputTest.cpp
+ * @brief This file contains golden-output tests of the text a kitchen writes: `Dish::appendTo` and `display`,
+ * `Kitchen::kitchenReport` and `Kitchen::dumpDishes`, compared byte for byte with the expected text.
+ *
+ * @date [10/15/2024]
+ * @author [Farhana Sultana]
+ */
+
+#include "Kitchen.hpp"
+#include "TestSupport.hpp"
+#include <climits>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string dishText(const Dish& a_dish) {
+    std::string buffer;
+    a_dish.appendTo(buffer);
+    std::ostringstream out;
+    a_dish.display(out);
+    KITCHEN_CHECK(out.str() == buffer);
+    return buffer;
+}
+
+std::string reportText(const Kitchen& kitchen) {
+    std::ostringstream out;
+    kitchen.kitchenReport(out);
+    std::string buffer;
+    kitchen.appendReport(buffer);
+    KITCHEN_CHECK(out.str() == buffer);
+    return buffer;
+}
+
+std::string dumpText(const Kitchen& kitchen) {
+    std::ostringstream out;
+    kitchen.dumpDishes(out);
+    return out.str();
+}
+
+/**
+ * @return A dish with the given preparation time and ingredient count; dishes of at least 5 ingredients and 60
+ * minutes are elaborate.
+ */
+Dish reportDish(int index, int prep_time, int ingredient_count, Dish::CuisineType cuisine_type) {
+    std::vector<std::string> ingredients(ingredient_count, "Salt");
+    for (int i = 0; i < ingredient_count; ++i) {
+        ingredients[i] += static_cast<char>('a' + i);
+    }
+    return Dish(testDishName(index), ingredients, prep_time, 1.0, cuisine_type);
+}
+
+void testDishText() {
+    KITCHEN_CHECK(dishText(Dish("Tacos", { "Tortilla", "Beef", "Lime" }, 20, 12.0, Dish::MEXICAN))
+                  == "Dish Name: Tacos\n"
+                     "Ingredients: Tortilla, Beef, Lime\n"
+                     "Preparation Time: 20 minutes\n"
+                     "Price: $12.00\n"
+                     "Cuisine Type: MEXICAN\n");
+    KITCHEN_CHECK(dishText(Dish("Pho", { "Noodles" }, 45, 3.05, Dish::OTHER))
+                  == "Dish Name: Pho\n"
+                     "Ingredients: Noodles\n"
+                     "Preparation Time: 45 minutes\n"
+                     "Price: $3.05\n"
+                     "Cuisine Type: OTHER\n");
+    KITCHEN_CHECK(dishText(Dish("Soup", {}, 0, 7.5, Dish::FRENCH))
+                  == "Dish Name: Soup\n"
+                     "Ingredients: \n"
+                     "Preparation Time: 0 minutes\n"
+                     "Price: $7.50\n"
+                     "Cuisine Type: FRENCH\n");
+    KITCHEN_CHECK(dishText(Dish()) == "Dish Name: UNKNOWN\n"
+                                      "Ingredients: \n"
+                                      "Preparation Time: 0 minutes\n"
+                                      "Price: $0.00\n"
+                                      "Cuisine Type: OTHER\n");
+
+    // Negative and extreme values
+    Dish refund("Refund", { "Nothing" }, -15, -0.05, Dish::AMERICAN);
+    KITCHEN_CHECK(dishText(refund) == "Dish Name: Refund\n"
+                                      "Ingredients: Nothing\n"
+                                      "Preparation Time: -15 minutes\n"
+                                      "Price: $-0.05\n"
+                                      "Cuisine Type: AMERICAN\n");
+    refund.setPrice(Price::fromCents(-1234));
+    refund.setPrepTime(INT_MIN);
+    KITCHEN_CHECK(dishText(refund).find("Preparation Time: -2147483648 minutes\nPrice: $-12.34\n") != std::string::npos);
+    Dish banquet("Banquet", { "Everything" }, INT_MAX, 0.0, Dish::ITALIAN);
+    banquet.setPrice(Price::fromCents(std::numeric_limits<Price::Cents>::max()));
+    KITCHEN_CHECK(dishText(banquet) == "Dish Name: Banquet\n"
+                                       "Ingredients: Everything\n"
+                                       "Preparation Time: 2147483647 minutes\n"
+                                       "Price: $92233720368547758.07\n"
+                                       "Cuisine Type: ITALIAN\n");
+    banquet.setPrice(Price::fromCents(std::numeric_limits<Price::Cents>::min()));
+    KITCHEN_CHECK(dishText(banquet).find("Price: $-92233720368547758.08\n") != std::string::npos);
+}
+
+void testReportText() {
+    Kitchen kitchen;
+    KITCHEN_CHECK(reportText(kitchen) == "ITALIAN: 0\nMEXICAN: 0\nCHINESE: 0\nINDIAN: 0\nAMERICAN: 0\nFRENCH: 0\nOTHER: 0\n"
+                                         "\nAVERAGE PREP TIME: 0\nELABORATE DISHES: 0.00%.\n\n");
+    KITCHEN_CHECK(dumpText(kitchen).empty());
+
+    // 7 elaborate dishes of 50 is exactly 14%; the average of 50 * 60 + 7 * 5 minutes over 50 is 60.7
+    for (int i = 0; i < 50; ++i) {
+        bool elaborate = i < 7;
+        KITCHEN_CHECK(kitchen.newOrder(reportDish(i, elaborate ? 65 : 60, elaborate ? 5 : 4,
+                                                  static_cast<Dish::CuisineType>(i % Dish::CUISINE_TYPE_COUNT))));
+    }
+    KITCHEN_CHECK(reportText(kitchen) == "ITALIAN: 8\nMEXICAN: 7\nCHINESE: 7\nINDIAN: 7\nAMERICAN: 7\nFRENCH: 7\nOTHER: 7\n"
+                                         "\nAVERAGE PREP TIME: 61\nELABORATE DISHES: 14.00%.\n\n");
+
+    // 1 of 3 rounds up to 33.34%, and an average of 10.5 rounds to 11
+    Kitchen thirds;
+    KITCHEN_CHECK(thirds.newOrder(reportDish(0, 60, 5, Dish::INDIAN)));
+    KITCHEN_CHECK(thirds.newOrder(reportDish(1, 0, 0, Dish::INDIAN)));
+    KITCHEN_CHECK(thirds.newOrder(reportDish(2, 0, 0, Dish::CHINESE)));
+    KITCHEN_CHECK(reportText(thirds) == "ITALIAN: 0\nMEXICAN: 0\nCHINESE: 1\nINDIAN: 2\nAMERICAN: 0\nFRENCH: 0\nOTHER: 0\n"
+                                        "\nAVERAGE PREP TIME: 20\nELABORATE DISHES: 33.34%.\n\n");
+    Kitchen halves;
+    KITCHEN_CHECK(halves.newOrder(reportDish(0, 10, 1, Dish::OTHER)));
+    KITCHEN_CHECK(halves.newOrder(reportDish(1, 11, 1, Dish::OTHER)));
+    KITCHEN_CHECK(reportText(halves) == "ITALIAN: 0\nMEXICAN: 0\nCHINESE: 0\nINDIAN: 0\nAMERICAN: 0\nFRENCH: 0\nOTHER: 2\n"
+                                        "\nAVERAGE PREP TIME: 11\nELABORATE DISHES: 0.00%.\n\n");
+
+    // Negative preparation times do not make the average negative
+    Kitchen negative;
+    KITCHEN_CHECK(negative.newOrder(reportDish(0, -30, 1, Dish::FRENCH)));
+    KITCHEN_CHECK(negative.newOrder(reportDish(1, 10, 1, Dish::FRENCH)));
+    KITCHEN_CHECK(reportText(negative) == "ITALIAN: 0\nMEXICAN: 0\nCHINESE: 0\nINDIAN: 0\nAMERICAN: 0\nFRENCH: 2\nOTHER: 0\n"
+                                          "\nAVERAGE PREP TIME: 0\nELABORATE DISHES: 0.00%.\n\n");
+}
+
+void testDumpText() {
+    Kitchen kitchen;
+    KITCHEN_CHECK(kitchen.newOrder(Dish("Tacos", { "Tortilla", "Beef" }, 20, 12.0, Dish::MEXICAN)));
+    KITCHEN_CHECK(kitchen.newOrder(Dish("Dal", { "Lentils" }, 35, 0.99, Dish::INDIAN)));
+    KITCHEN_CHECK(kitchen.newOrder(Dish("Toast", {}, 5, 0.1, Dish::OTHER)));
+    const std::string TACOS = "Dish Name: Tacos\nIngredients: Tortilla, Beef\nPreparation Time: 20 minutes\n"
+                              "Price: $12.00\nCuisine Type: MEXICAN\n";
+    const std::string DAL = "Dish Name: Dal\nIngredients: Lentils\nPreparation Time: 35 minutes\n"
+                            "Price: $0.99\nCuisine Type: INDIAN\n";
+    const std::string TOAST = "Dish Name: Toast\nIngredients: \nPreparation Time: 5 minutes\n"
+                              "Price: $0.10\nCuisine Type: OTHER\n";
+    KITCHEN_CHECK(dumpText(kitchen) == TACOS + DAL + TOAST);
+
+    // Serving a dish moves the last one into its slot
+    KITCHEN_CHECK(kitchen.serveDish(Dish("Tacos", { "Tortilla", "Beef" }, 20, 12.0, Dish::MEXICAN)));
+    KITCHEN_CHECK(dumpText(kitchen) == TOAST + DAL);
+    std::string buffer = "Dishes:\n";
+    kitchen.appendDishes(buffer);
+    KITCHEN_CHECK(buffer == "Dishes:\n" + TOAST + DAL);
+}
+
+} // namespace
+
+int main() {
+    testDishText();
+    testReportText();
+    testDumpText();
+    return 0;
+}